@@ -37,12 +37,25 @@
 //    example the data_t class which further groups the input signals,
 //    exports, and output signals; we use structural nesting to provide
 //    naming consistency, as opposed to using long names.
+//  - when MODEL_CONTROL_PACKED is defined, the four control signals in
+//    each direction are carried as one packed channel; see: model.h.  The
+//    packed outputs mix the combinational advance with clocked bits, and
+//    a channel has a single writer, so one process, cycle(), then does
+//    the work of both compute_advance() and cycle().
+//  - when MODEL_NO_DEBUG_STRING is defined, the debug string ports and
+//    signals do not exist; the cycle does no heap allocation.
 //
 //  NOTES:
 //  2023-08-10: Moore, Peimann: first cut.
 //  2023-08-11: Peimann: revised control signals to generic model.
 //  2023-09-09: Moore, Peimann: minor diagnostic changes.
 //  2023-09-11: Moore, Peimann: minimize diagnostic output.
+//  2026-10-16: cycle logic hoisted into EXAMPLE/single_cycle_model.h.
+//  2026-10-16: clock(...) accepts any clock source; see: clocking.h.
+//  2026-10-16: packed control buses when MODEL_CONTROL_PACKED is defined.
+//  2026-10-16: no debug string channels when MODEL_NO_DEBUG_STRING is
+//              defined.
+//  2026-10-16: restore(...) sets the module state from a checkpoint.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -60,6 +73,7 @@
   //--required project includes
 # include "SC.h"
 # include "model.h"
+# include "EXAMPLE/single_cycle_model.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--declaratons
@@ -72,6 +86,11 @@
   //--definitions
   class EXAMPLE::single_cycle_t final : public SC::module
   {
+    private:  // forward declarations and type aliases
+      using cycle_model_t = ::EXAMPLE::single_cycle_model_t;
+      using cycle_input_t = cycle_model_t::input_t;
+      using cycle_state_t = cycle_model_t::state_t;
+
     public:    // c'tor and d'tor
       single_cycle_t(SC::module_name const& name)
         : SC::module{name}
@@ -80,6 +99,11 @@
         , m_data{}
         , m_debug{}
       {
+#if  defined(MODEL_CONTROL_PACKED)
+        SC_METHOD(cycle);
+        sensitive << m_clock.in.clock.pos();
+        sensitive << m_control.in.bus;
+#else
         SC_METHOD(compute_advance);
         sensitive << m_control.in.is_advance;
         sensitive << m_control.out.is_stall;
@@ -87,15 +111,22 @@
 
         SC_METHOD(cycle);
         sensitive << m_clock.in.clock.pos();
+#endif
       }
 
     public:   // accessors
     public:   // methods
-      void clock(model::signal::clock_t &clock)
+      void clock(model::signal::clock_if_t &clock)
       { // clocking signals
         m_clock.in.clock.bind(clock);
       }
 
+#if  defined(MODEL_CONTROL_PACKED)
+      void control_in(model::signal::control_in_t &bus)
+      { // packed control signal inputs
+        m_control.in.bus.bind(bus);
+      }
+#else
       void control_in(model::signal::reset_t      &reset,
                       model::signal::is_advance_t &is_advance,
                       model::signal::is_flush_t   &is_flush,
@@ -106,6 +137,7 @@
         m_control.in.is_flush.bind(is_flush);
         m_control.in.is_valid.bind(is_valid);
       }
+#endif
 
       auto &control_out()
       { // return control signal exports
@@ -122,15 +154,21 @@
         return  m_data.out;
       }
 
-      void debug_in(model::signal::i_number_t &i_number,
-                    model::signal::i_binary_t &i_binary,
-                    model::signal::is_error_t &is_error,
-                    SC::signal<std::string>   &string)
+      void debug_in(model::signal::i_number_t     &i_number,
+                    model::signal::i_binary_t     &i_binary,
+#if  defined(MODEL_NO_DEBUG_STRING)
+                    model::signal::is_error_t     &is_error)
+#else
+                    model::signal::is_error_t     &is_error,
+                    model::signal::debug_string_t &string)
+#endif
       { // bind debug input signals
         m_debug.in.i_number.bind(i_number);
         m_debug.in.i_binary.bind(i_binary);
         m_debug.in.is_error.bind(is_error);
+#if  not defined(MODEL_NO_DEBUG_STRING)
         m_debug.in.string.bind(string);
+#endif
       }
 
       auto &debug_out()
@@ -138,8 +176,17 @@
         return  m_debug.out;
       }
 
+      void restore(cycle_state_t const &state)
+      { // restore the module state, as output.
+        // NB: before the simulation starts; the writes are seen from the
+        //     first edge, see: ::vif::EXAMPLE::single_cycle_signal_t.
+        // NB: ctl.is_advance is recomputed once the simulation starts.
+        publish_state(state, state.is_advance);
+      }
+
     protected:// methods
     private:  // methods
+#if  not defined(MODEL_CONTROL_PACKED)
       void compute_advance()
       { // dynamically compute the advance/must-take signal.
 #if  false  // works
@@ -192,106 +239,139 @@
         // "current" state from next module
         ::model::is_advance_t next_is_advance{m_control.in.is_advance->read()};
 
-        bool is_advance{(not state_is_stall) and
-                        ((not state_is_valid) or next_is_advance)};
+        bool is_advance{cycle_model_t::advance(state_is_stall,
+                                               state_is_valid,
+                                               next_is_advance)};
 #endif
 
         m_control.out.is_advance->write(is_advance);
       }
+#endif
 
       void cycle()
       { // 
+#if  defined(MODEL_CONTROL_PACKED)
+        //--between edges a control input changed; recompute the
+        //--combinational advance only.
+        if  (not m_clock.in.clock.posedge())
+        {
+          publish_control(sample_state(), m_control.in.bus->read().is_advance());
+          return;
+        }
+#endif
+
         //--capture the current state of inputs into a local struct.
-        cycle_input_t const in
-        { // read input values directly into structure
+        cycle_input_t const in{sample_input()};
+
+        //--capture the current State of The Union into a local struct.
+        //--NB: this structure updates in-place and is written following
+        //      the signal computation logic.
+        cycle_state_t state{sample_state()};
+
+        //--do the ugly computation
+        //--NB: shared with the native vif backend.
+        cycle_model_t::cycle(in, state);
+
+        //--update the outputs
+        publish_state(state, in.is_advance);
+
+        //--end of compilation unit with implicit return
+      }
+
+      cycle_input_t sample_input() const
+      { // read input values directly into structure
+#if  defined(MODEL_CONTROL_PACKED)
+        auto const &control{m_control.in.bus->read()};
+#endif
+        return  cycle_input_t
+        {
+#if  defined(MODEL_CONTROL_PACKED)
+          control.reset(),
+          control.is_advance(),
+          control.is_flush(),
+          control.is_valid(),
+#else
           m_control.in.reset->read(),
           m_control.in.is_advance->read(),
           m_control.in.is_flush->read(),
           m_control.in.is_valid->read(),
+#endif
           m_data.in.value->read(),
           m_debug.in.i_binary->read(),
           m_debug.in.i_number->read(),
           m_debug.in.is_error->read(),
+#if  defined(MODEL_NO_DEBUG_STRING)
+          model::debug_string_t{},
+#else
           m_debug.in.string->read(),
+#endif
         };
+      }
 
-        //--capture the current State of The Union into a local struct.
-        //--NB: this structure updates in-place and is written following
-        //      the signal computation logic.
-        cycle_state_t state
-        { // read state values directly into structure
+      cycle_state_t sample_state() const
+      { // read state values directly into structure
+#if  defined(MODEL_CONTROL_PACKED)
+        auto const &control{m_control.out.bus->read()};
+#endif
+        return  cycle_state_t
+        {
+#if  defined(MODEL_CONTROL_PACKED)
+          control.is_advance(),
+          control.is_error(),
+          control.is_stall(),
+          control.is_valid(),
+#else
           m_control.out.is_advance->read(),
           m_control.out.is_error->read(),
           m_control.out.is_stall->read(),
           m_control.out.is_valid->read(),
+#endif
           m_data.out.value->read(),
           m_debug.out.i_binary->read(),
           m_debug.out.i_number->read(),
+#if  defined(MODEL_NO_DEBUG_STRING)
+          model::debug_string_t{},
+#else
           m_debug.out.string->read(),
+#endif
         };
+      }
 
-        //--do the ugly computation
-        if  (in.reset == 0)
-        { // minimal reset necessary
-          // NB: shift back to well-known control signal state
-          state.is_error = false;
-          state.is_stall = false;
-          state.is_valid = false;
-          // not updated: value, i_binary, i_number
-          state.string   = ("RESET: " + in.string);
-        }
-        else if  (in.is_flush)
-        { // a branch occurred in a subsequent pipeline stage
-          // NB: discard any held, valid data
-          // NB: assume prior stage data are moot; take no data
-          state.is_error = (state.is_error or in.is_error);
-          state.is_stall = false;
-          state.is_valid = false;
-          // not updated: value, i_binary, i_number
-          state.string   = ("FLUSH: " + in.string);
-        }
-        else if  (state.is_stall)
-        { // single-cycle modules should never stall.
-          state.is_error = true;
-          state.is_stall = false;
-          state.is_valid = false;
-          // not updated: value, i_binary, i_number
-          state.string   = ("STALL: " + in.string);
-
-          //FIXME: remove exception for synthesis.
-          throw  ::std::logic_error("Single-Vycle modules"
-                                    " ought never stall.");
-        }
-        else if  (state.is_advance)
-        { // pipeline advances take input data and transform them
-          state.is_error = (state.is_error or in.is_error);
-          state.is_stall = false;
-          state.is_valid = in.is_valid;
-          state.value    = (compl in.value);
-          state.i_binary = in.i_binary;
-          state.i_number = in.i_number;
-          state.string   = ("ADVANCE: " + in.string);
-        }
-        else
-        { // nothing to do
-          state.is_error = (state.is_error or in.is_error);
-          // not updated: is_stall, is_valid, value, i_binary, i_number
-          state.string   = ("NOP: " + in.string);
-        }
-
-        //--update the outputs
-        m_control.out.is_error->write(state.is_error);
-        m_control.out.is_stall->write(state.is_stall);
-        m_control.out.is_valid->write(state.is_valid);
+      void publish_state(
+        cycle_state_t const       &state,
+        model::is_advance_t const  next_is_advance)
+      { // write the clocked outputs.
+        publish_control(state, next_is_advance);
 
         m_data.out.value->write(state.value);
 
         m_debug.out.i_binary->write(state.i_binary);
         m_debug.out.i_number->write(state.i_number);
         m_debug.out.is_advance->write(state.is_advance);
+#if  not defined(MODEL_NO_DEBUG_STRING)
         m_debug.out.string->write(state.string);
+#endif
+      }
 
-        //--end of compilation unit with implicit return
+      void publish_control(
+        cycle_state_t const       &state,
+        model::is_advance_t const  next_is_advance [[maybe_unused]])
+      { // write the clocked control outputs.
+        // NB: packed, the combinational advance is written alongside.
+#if  defined(MODEL_CONTROL_PACKED)
+        bool const is_advance{cycle_model_t::advance(state.is_stall,
+                                                     state.is_valid,
+                                                     next_is_advance)};
+        m_control.out.bus->write(
+          model::control_out_t::pack(is_advance,
+                                     state.is_error,
+                                     state.is_stall,
+                                     state.is_valid));
+#else
+        m_control.out.is_error->write(state.is_error);
+        m_control.out.is_stall->write(state.is_stall);
+        m_control.out.is_valid->write(state.is_valid);
+#endif
       }
 
     private:  // local types
@@ -315,6 +395,32 @@
         } out;
       };
 
+#if  defined(MODEL_CONTROL_PACKED)
+      struct control_t final
+      {
+        struct in_t
+        {
+          model::port::in::control_in_t bus;    // reset, is_advance, &c.
+        };
+        struct out_t
+        {
+          model::exprt::control_out_t   bus;    // is_advance, is_error, &c.
+        };
+        struct signal_t
+        {
+          model::signal::control_out_t  bus;    // is_advance, is_error, &c.
+        };
+
+        in_t     in;
+        out_t    out;
+        signal_t signal;
+
+        control_t(): in{}, out{}, signal{}
+        {
+          out.bus.bind(signal.bus);
+        }
+      };
+#else
       struct control_t final
       {
         struct in_t
@@ -351,31 +457,7 @@
           out.is_valid.bind(signal.is_valid);
         }
       };
-
-      struct cycle_input_t
-      { // input control and diagnostic values for the cycle() method.
-        model::reset_t      reset;
-        model::is_advance_t is_advance;
-        model::is_flush_t   is_flush;
-        model::is_valid_t   is_valid;
-        model::value_t      value;
-        model::i_binary_t   i_binary;
-        model::i_number_t   i_number;
-        model::is_error_t   is_error;    // stimulus to force error bit
-        std::string         string;      // diagnostic string
-      };
-
-      struct cycle_state_t
-      { // state of this module; updates in-place in cycle() method.
-        bool const        is_advance;
-        model::is_error_t is_error;
-        model::is_stall_t is_stall;
-        model::is_valid_t is_valid;
-        model::value_t    value;
-        model::i_binary_t i_binary;
-        model::i_number_t i_number;
-        std::string       string;
-      };
+#endif
 
       struct data_t final
       {
@@ -406,24 +488,30 @@
       {
         struct in_t
         { // input ports
-          model::port::in::i_number_t i_number;
-          model::port::in::i_binary_t i_binary;
-          model::port::in::is_error_t is_error;
-          SC::in<std::string>         string;
+          model::port::in::i_number_t     i_number;
+          model::port::in::i_binary_t     i_binary;
+          model::port::in::is_error_t     is_error;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+          model::port::in::debug_string_t string;
+#endif
         };
         struct out_t
         { // exports for signals
-          model::exprt::i_number_t           i_number;
-          model::exprt::i_binary_t           i_binary;
-          model::exprt::is_advance_t         is_advance;
-          SC::exprt<SC::signal<std::string>> string;
+          model::exprt::i_number_t     i_number;
+          model::exprt::i_binary_t     i_binary;
+          model::exprt::is_advance_t   is_advance;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+          model::exprt::debug_string_t string;
+#endif
         };
         struct signal_t
         { // we own the signals we generate
-          model::signal::i_number_t   i_number;
-          model::signal::i_binary_t   i_binary;
-          model::signal::is_advance_t is_advance;
-          SC::signal<std::string>     string;
+          model::signal::i_number_t     i_number;
+          model::signal::i_binary_t     i_binary;
+          model::signal::is_advance_t   is_advance;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+          model::signal::debug_string_t string;
+#endif
         };
 
         in_t     in;
@@ -435,7 +523,9 @@
           out.i_number.bind(signal.i_number);
           out.i_binary.bind(signal.i_binary);
           out.is_advance.bind(signal.is_advance);
+#if  not defined(MODEL_NO_DEBUG_STRING)
           out.string.bind(signal.string);
+#endif
         }
       };
 
@@ -0,0 +1,217 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  EXAMPLE/single_cycle_bank.h
+//  - bit-sliced cycle model of 64 independent EXAMPLE/single_cycle.h
+//    modules; one evaluation clocks every lane.
+//  - the same logic as EXAMPLE/single_cycle_model.h, lane for lane.
+//
+//  Design Decisions:
+//  - each control bit is a 64-bit word, one bit per lane; the control
+//    logic is a handful of word-wide boolean operations, whatever the
+//    number of lanes in use.
+//  - the data path is one array per value, one element per lane; the
+//    cycle updates them in a branch-free loop the compiler vectorises.
+//  - the case analysis of single_cycle_model_t::cycle(...) becomes one
+//    mask per case; the cases are mutually exclusive, lane by lane.
+//  - lanes carry no debug strings; as per the TLM-2.0 target.
+//
+//  NOTES:
+//  2026-10-16: created.
+//  2026-10-16: a lane's state can be set, see: lane(...); for restores.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__EXAMPLE_SINGLE_CYCLE_BANK_H__)
+# define __EXAMPLE_SINGLE_CYCLE_BANK_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <array>
+# include <cstddef>
+# include <cstdint>
+# include <stdexcept>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "model.h"
+# include "EXAMPLE/single_cycle_model.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+  namespace EXAMPLE
+  {
+    class single_cycle_bank_t;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+  class EXAMPLE::single_cycle_bank_t final
+  {
+    public:   // published types
+      using lanes_t = ::std::uint64_t;  // one bit per lane
+
+      static ::std::size_t constexpr lanes{64};
+
+      template<typename VALUE_T>
+      using lane_array_t = ::std::array<VALUE_T, lanes>;
+
+      using model_t = ::EXAMPLE::single_cycle_model_t;
+
+      struct input_t
+      { // input control and diagnostic values for the cycle() method.
+        lanes_t                         reset;
+        lanes_t                         is_advance;
+        lanes_t                         is_flush;
+        lanes_t                         is_valid;
+        lanes_t                         is_error;  // stimulus to force error bit
+        lane_array_t<model::value_t>    value;
+        lane_array_t<model::i_binary_t> i_binary;
+        lane_array_t<model::i_number_t> i_number;
+      };
+
+      struct state_t
+      { // state of every lane; updates in-place in cycle() method.
+        // NB: is_advance is the combinational advance at the clock edge,
+        //     see: advance(...).
+        lanes_t                         is_advance;
+        lanes_t                         is_error;
+        lanes_t                         is_stall;
+        lanes_t                         is_valid;
+        lane_array_t<model::value_t>    value;
+        lane_array_t<model::i_binary_t> i_binary;
+        lane_array_t<model::i_number_t> i_number;
+      };
+
+    public:   // methods
+      static lanes_t advance(lanes_t const state_is_stall,
+                             lanes_t const state_is_valid,
+                             lanes_t const next_is_advance)
+      { // as per single_cycle_model_t::advance(...), every lane at once.
+        return  ((compl state_is_stall) bitand
+                 ((compl state_is_valid) bitor next_is_advance));
+      }
+
+      static void cycle(input_t const &in, state_t &state)
+      { // clock every lane once, given the sampled inputs.
+        // NB: one mask per case of single_cycle_model_t::cycle(...).
+        lanes_t const is_reset  {compl in.reset};
+        lanes_t const is_flush  {(compl is_reset) bitand in.is_flush};
+        lanes_t const is_stall  {(compl (is_reset bitor is_flush))
+                                 bitand state.is_stall};
+        lanes_t const is_advance{(compl (is_reset bitor is_flush bitor is_stall))
+                                 bitand state.is_advance};
+        lanes_t const is_nop    {compl (is_reset bitor is_flush bitor
+                                        is_stall bitor is_advance)};
+
+        //--control path
+        state.is_error = ((compl is_reset) bitand
+                          (state.is_error bitor in.is_error bitor is_stall));
+        state.is_stall = (is_nop bitand state.is_stall);
+        state.is_valid = ((is_advance bitand in.is_valid) bitor
+                          (is_nop     bitand state.is_valid));
+
+        //--data path; advancing lanes take input data and transform them
+        for  (::std::size_t ix{0}; ix < lanes; ++ix)
+        {
+          auto const take{static_cast<::std::uint32_t>(
+                            0u - ((is_advance >> ix) bitand 1u))};
+          state.value[ix]    = select(take, (compl in.value[ix]), state.value[ix]);
+          state.i_binary[ix] = select(take, in.i_binary[ix], state.i_binary[ix]);
+          state.i_number[ix] = select(take, in.i_number[ix], state.i_number[ix]);
+        }
+
+        //FIXME: remove exception for synthesis.
+        if  (is_stall != 0)
+          throw  ::std::logic_error("Single-Vycle modules"
+                                    " ought never stall.");
+      }
+
+      static void lane(input_t                 &bank,
+                       ::std::size_t const      ix,
+                       model_t::input_t const  &input)
+      { // set the given lane's inputs
+        // NB: the debug string is dropped.
+        bank.reset        = with(bank.reset,      ix, input.reset);
+        bank.is_advance   = with(bank.is_advance, ix, input.is_advance);
+        bank.is_flush     = with(bank.is_flush,   ix, input.is_flush);
+        bank.is_valid     = with(bank.is_valid,   ix, input.is_valid);
+        bank.is_error     = with(bank.is_error,   ix, input.is_error);
+        bank.value[ix]    = input.value;
+        bank.i_binary[ix] = input.i_binary;
+        bank.i_number[ix] = input.i_number;
+      }
+
+      static void lane(state_t                 &bank,
+                       ::std::size_t const      ix,
+                       model_t::state_t const  &state)
+      { // set the given lane's state
+        // NB: the debug string is dropped.
+        bank.is_advance   = with(bank.is_advance, ix, state.is_advance);
+        bank.is_error     = with(bank.is_error,   ix, state.is_error);
+        bank.is_stall     = with(bank.is_stall,   ix, state.is_stall);
+        bank.is_valid     = with(bank.is_valid,   ix, state.is_valid);
+        bank.value[ix]    = state.value;
+        bank.i_binary[ix] = state.i_binary;
+        bank.i_number[ix] = state.i_number;
+      }
+
+      static model_t::state_t lane(state_t const       &bank,
+                                   ::std::size_t const  ix)
+      { // get the given lane's state
+        // NB: the debug string is empty.
+        return
+        {
+          is_set(bank.is_advance, ix),
+          is_set(bank.is_error,   ix),
+          is_set(bank.is_stall,   ix),
+          is_set(bank.is_valid,   ix),
+          bank.value[ix],
+          bank.i_binary[ix],
+          bank.i_number[ix],
+          {},
+        };
+      }
+
+    private:  // methods
+      static ::std::uint32_t select(::std::uint32_t const take,
+                                    ::std::uint32_t const taken,
+                                    ::std::uint32_t const kept)
+      { // NB: take is all ones or all zeros
+        return  ((take bitand taken) bitor ((compl take) bitand kept));
+      }
+
+      static bool is_set(lanes_t const lanes_in, ::std::size_t const ix)
+      { return  (((lanes_in >> ix) bitand 1u) == 1u); }
+
+      static lanes_t with(lanes_t const       lanes_in,
+                          ::std::size_t const ix,
+                          bool const          bit)
+      { return  ((lanes_in bitand (compl (lanes_t{1} << ix))) bitor
+                 (lanes_t{bit} << ix)); }
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__EXAMPLE_SINGLE_CYCLE_BANK_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
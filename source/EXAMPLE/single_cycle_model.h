@@ -0,0 +1,168 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  EXAMPLE/single_cycle_model.h
+//  - plain C++ cycle model of the EXAMPLE/single_cycle.h module.
+//  - holds the combinational (advance) and clocked (cycle) logic, free
+//    of SystemC signals and processes.
+//
+//  Design Decisions:
+//  - the SystemC module reads its ports into the model's input and state
+//    structures, steps the model, and writes the state back out; the
+//    native vif backend steps the very same model directly.  Both paths
+//    therefore execute identical logic.
+//  - the state updates in-place, as it did in the module's cycle().
+//
+//  NOTES:
+//  2026-10-16: created; logic hoisted from EXAMPLE/single_cycle.h.
+//  2026-10-16: input_t and state_t compare equal; see: driver time warp.
+//  2026-10-16: debug strings are model::debug_string_t; see: model.h.
+//  2026-10-16: the cycle decorates the input label, rather than building
+//              a new string; see: label.h.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__EXAMPLE_SINGLE_CYCLE_MODEL_H__)
+# define __EXAMPLE_SINGLE_CYCLE_MODEL_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <string>
+# include <stdexcept>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "model.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+  namespace EXAMPLE
+  {
+    class single_cycle_model_t;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+  class EXAMPLE::single_cycle_model_t final
+  {
+    public:   // published types
+      struct input_t
+      { // input control and diagnostic values for the cycle() method.
+        model::reset_t        reset;
+        model::is_advance_t   is_advance;
+        model::is_flush_t     is_flush;
+        model::is_valid_t     is_valid;
+        model::value_t        value;
+        model::i_binary_t     i_binary;
+        model::i_number_t     i_number;
+        model::is_error_t     is_error;  // stimulus to force error bit
+        model::debug_string_t string;    // diagnostic string
+
+        bool operator==(input_t const &) const = default;
+      };
+
+      struct state_t
+      { // state of the module; updates in-place in cycle() method.
+        // NB: is_advance is the combinational advance at the clock edge,
+        //     see: advance(...).
+        model::is_advance_t   is_advance;
+        model::is_error_t     is_error;
+        model::is_stall_t     is_stall;
+        model::is_valid_t     is_valid;
+        model::value_t        value;
+        model::i_binary_t     i_binary;
+        model::i_number_t     i_number;
+        model::debug_string_t string;
+
+        bool operator==(state_t const &) const = default;
+      };
+
+    public:   // methods
+      static model::is_advance_t advance(
+        model::is_stall_t const   state_is_stall,
+        model::is_valid_t const   state_is_valid,
+        model::is_advance_t const next_is_advance)
+      { // compute the advance/must-take signal from the "current" state,
+        // as computed at start of cycle, and the next module's advance.
+        return  ((not state_is_stall) and
+                 ((not state_is_valid) or next_is_advance));
+      }
+
+      static void cycle(input_t const &in, state_t &state)
+      { // clock the module state once, given the sampled inputs.
+        using ::label::decoration_t;
+
+        if  (in.reset == 0)
+        { // minimal reset necessary
+          // NB: shift back to well-known control signal state
+          state.is_error = false;
+          state.is_stall = false;
+          state.is_valid = false;
+          // not updated: value, i_binary, i_number
+          state.string   = in.string.decorated(decoration_t::reset);
+        }
+        else if  (in.is_flush)
+        { // a branch occurred in a subsequent pipeline stage
+          // NB: discard any held, valid data
+          // NB: assume prior stage data are moot; take no data
+          state.is_error = (state.is_error or in.is_error);
+          state.is_stall = false;
+          state.is_valid = false;
+          // not updated: value, i_binary, i_number
+          state.string   = in.string.decorated(decoration_t::flush);
+        }
+        else if  (state.is_stall)
+        { // single-cycle modules should never stall.
+          state.is_error = true;
+          state.is_stall = false;
+          state.is_valid = false;
+          // not updated: value, i_binary, i_number
+          state.string   = in.string.decorated(decoration_t::stall);
+
+          //FIXME: remove exception for synthesis.
+          throw  ::std::logic_error("Single-Vycle modules"
+                                    " ought never stall.");
+        }
+        else if  (state.is_advance)
+        { // pipeline advances take input data and transform them
+          state.is_error = (state.is_error or in.is_error);
+          state.is_stall = false;
+          state.is_valid = in.is_valid;
+          state.value    = (compl in.value);
+          state.i_binary = in.i_binary;
+          state.i_number = in.i_number;
+          state.string   = in.string.decorated(decoration_t::advance);
+        }
+        else
+        { // nothing to do
+          state.is_error = (state.is_error or in.is_error);
+          // not updated: is_stall, is_valid, value, i_binary, i_number
+          state.string   = in.string.decorated(decoration_t::nop);
+        }
+      }
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__EXAMPLE_SINGLE_CYCLE_MODEL_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
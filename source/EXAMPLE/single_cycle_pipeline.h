@@ -0,0 +1,335 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  EXAMPLE/single_cycle_pipeline.h
+//  - an N-stage pipeline composed of EXAMPLE/single_cycle.h modules.
+//  - the head stage takes the pipeline's inputs, the tail stage gives
+//    the pipeline's outputs; each stage in between is chained to its
+//    neighbours through the generic stage handshake.
+//
+//  Design Decisions:
+//  - stage k takes its valid bit, data value, and debug values from stage
+//    k-1, and its advance bit from stage k+1; reset, flush, and the error
+//    stimulus are common to every stage.
+//  - the advance bit is combinational, thus a change of the tail's advance
+//    input ripples towards the head, one delta cycle per stage.  This is
+//    the signal propagation cost of a deep pipeline.
+//  - the pipeline's control inputs are four signals whatever the build;
+//    when MODEL_CONTROL_PACKED is defined, one link process per stage
+//    packs its stage's inputs from them and from the neighbouring stages'
+//    packed outputs.  A link costs one more delta cycle per stage.
+//  - the outputs are those of the head and tail stages, see: head() and
+//    tail(); as is_advance() and is_valid(), &c., whatever the build.
+//
+//  NOTES:
+//  2026-10-16: created.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__EXAMPLE_SINGLE_CYCLE_PIPELINE_H__)
+# define __EXAMPLE_SINGLE_CYCLE_PIPELINE_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <cstddef>
+# include <memory>
+# include <ranges>
+# include <stdexcept>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+# include "model.h"
+# include "EXAMPLE/single_cycle.h"
+# include "utility.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+  namespace EXAMPLE
+  {
+    class single_cycle_pipeline_t;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+  class EXAMPLE::single_cycle_pipeline_t final : public SC::module
+  {
+    public:   // published types
+      using stage_t = ::EXAMPLE::single_cycle_t;
+
+    public:    // c'tor and d'tor
+      single_cycle_pipeline_t(SC::module_name const &name,
+                              ::std::size_t const    depth)
+        : SC::module{name}
+        , m_stage{}
+#if  defined(MODEL_CONTROL_PACKED)
+        , m_control{}
+        , m_link{}
+#endif
+      {
+        if  (depth < 1)
+          throw  ::std::invalid_argument("A pipeline has one or more stages.");
+
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, depth))
+          m_stage.emplace_back(new stage_t{::utility::format::indexed("stage", ix).c_str()});
+
+#if  defined(MODEL_CONTROL_PACKED)
+        //--NB: the links read the pipeline's control ports, bound later
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, depth))
+        {
+          m_link.emplace_back(new link_t{::utility::format::indexed("link", ix).c_str(),
+                                         m_control,
+                                         is_head(ix) ? nullptr : &bus_of(ix - 1),
+                                         is_tail(ix) ? nullptr : &bus_of(ix + 1)});
+          m_stage[ix]->control_in(m_link.back()->bus);
+        }
+#endif
+      }
+
+      single_cycle_pipeline_t(single_cycle_pipeline_t const &) = delete;
+      single_cycle_pipeline_t &operator=(single_cycle_pipeline_t const &) = delete;
+
+    public:   // accessors
+      ::std::size_t depth() const
+      { return  m_stage.size(); }
+
+      stage_t &stage(::std::size_t const index)
+      { return  *(m_stage.at(index)); }
+
+      stage_t &head()
+      { return  *(m_stage.front()); }
+
+      stage_t &tail()
+      { return  *(m_stage.back()); }
+
+      model::is_advance_t is_advance()
+      { // the head stage's advance; to the prior stage
+#if  defined(MODEL_CONTROL_PACKED)
+        return  head().control_out().bus->read().is_advance();
+#else
+        return  head().control_out().is_advance->read();
+#endif
+      }
+
+      model::is_error_t is_error()
+      { // the tail stage's error bit
+#if  defined(MODEL_CONTROL_PACKED)
+        return  tail().control_out().bus->read().is_error();
+#else
+        return  tail().control_out().is_error->read();
+#endif
+      }
+
+      model::is_valid_t is_valid()
+      { // the tail stage's valid bit; to the next stage
+#if  defined(MODEL_CONTROL_PACKED)
+        return  tail().control_out().bus->read().is_valid();
+#else
+        return  tail().control_out().is_valid->read();
+#endif
+      }
+
+      model::value_t value()
+      { // the tail stage's data value; to the next stage
+        return  tail().data_out().value->read();
+      }
+
+    public:   // methods
+      void clock(model::signal::clock_if_t &clock)
+      { // clocking signals; every stage
+        for  (auto &each: m_stage)
+          each->clock(clock);
+      }
+
+      void control_in(model::signal::reset_t      &reset,
+                      model::signal::is_advance_t &is_advance,
+                      model::signal::is_flush_t   &is_flush,
+                      model::signal::is_valid_t   &is_valid)
+      { // control signal inputs
+        // NB: is_advance is the next stage's, to the tail; is_valid is the
+        //     prior stage's, to the head.
+#if  defined(MODEL_CONTROL_PACKED)
+        m_control.reset.bind(reset);
+        m_control.is_advance.bind(is_advance);
+        m_control.is_flush.bind(is_flush);
+        m_control.is_valid.bind(is_valid);
+#else
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, depth()))
+          m_stage[ix]->control_in(
+            reset,
+            is_tail(ix) ? is_advance
+                        : signal_of(m_stage[ix + 1]->control_out().is_advance),
+            is_flush,
+            is_head(ix) ? is_valid
+                        : signal_of(m_stage[ix - 1]->control_out().is_valid));
+#endif
+      }
+
+      void data_in(model::signal::value_t &value)
+      { // data value to the head; each stage's from the one before
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, depth()))
+          m_stage[ix]->data_in(
+            is_head(ix) ? value
+                        : signal_of(m_stage[ix - 1]->data_out().value));
+      }
+
+      void debug_in(model::signal::i_number_t     &i_number,
+                    model::signal::i_binary_t     &i_binary,
+#if  defined(MODEL_NO_DEBUG_STRING)
+                    model::signal::is_error_t     &is_error)
+#else
+                    model::signal::is_error_t     &is_error,
+                    model::signal::debug_string_t &string)
+#endif
+      { // debug values to the head; each stage's from the one before
+        // NB: the error stimulus is common to every stage.
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, depth()))
+        {
+          if  (is_head(ix))
+          {
+#if  defined(MODEL_NO_DEBUG_STRING)
+            m_stage[ix]->debug_in(i_number, i_binary, is_error);
+#else
+            m_stage[ix]->debug_in(i_number, i_binary, is_error, string);
+#endif
+            continue;
+          }
+
+          auto &prior{m_stage[ix - 1]->debug_out()};
+#if  defined(MODEL_NO_DEBUG_STRING)
+          m_stage[ix]->debug_in(signal_of(prior.i_number),
+                                signal_of(prior.i_binary),
+                                is_error);
+#else
+          m_stage[ix]->debug_in(signal_of(prior.i_number),
+                                signal_of(prior.i_binary),
+                                is_error,
+                                signal_of(prior.string));
+#endif
+        }
+      }
+
+    private:  // methods
+      bool is_head(::std::size_t const index) const
+      { return  (index == 0); }
+
+      bool is_tail(::std::size_t const index) const
+      { return  ((index + 1) == depth()); }
+
+      template<typename IF>
+      static IF &signal_of(SC::exprt<IF> &exprt)
+      { // the signal bound into an export
+        return  exprt;
+      }
+
+#if  defined(MODEL_CONTROL_PACKED)
+      model::signal::control_out_t &bus_of(::std::size_t const index)
+      { // the packed control outputs of the given stage
+        return  signal_of(m_stage[index]->control_out().bus);
+      }
+#endif
+
+    private:  // local types
+#if  defined(MODEL_CONTROL_PACKED)
+      struct control_t final
+      { // the pipeline's control inputs; see: control_in(...)
+        model::port::in::reset_t       reset;      // system reset
+        model::port::in::is_advance_t  is_advance; // next stage advance bit
+        model::port::in::is_flush_t    is_flush;   // stage flush bit
+        model::port::in::is_valid_t    is_valid;   // prior stage data valid
+      };
+
+      class link_t final : public SC::module
+      { // packs one stage's control inputs from the pipeline's control
+        // inputs and the neighbouring stages' packed control outputs.
+        // NB: no prior stage; the pipeline's is_valid.  No next stage;
+        //     the pipeline's is_advance.
+        public:   // c'tors and d'tor
+          link_t(SC::module_name                     name,
+                 control_t                          &control,
+                 model::signal::control_out_t const *prior,
+                 model::signal::control_out_t const *next)
+            : SC::module{name}
+            , bus{"bus"}
+            , m_control{control}
+            , m_prior{prior}
+            , m_next{next}
+          {
+            SC_METHOD(link);
+            sensitive << m_control.reset;
+            sensitive << m_control.is_flush;
+            if  (m_prior == nullptr)
+              sensitive << m_control.is_valid;
+            else
+              sensitive << *m_prior;
+            if  (m_next == nullptr)
+              sensitive << m_control.is_advance;
+            else
+              sensitive << *m_next;
+          }
+
+          link_t(link_t const &) = delete;
+          link_t &operator=(link_t const &) = delete;
+
+        public:   // attributes
+          model::signal::control_in_t bus;  // the stage's control inputs
+
+        private:  // methods
+          void link()
+          {
+            bool const is_advance{(m_next == nullptr)
+                                  ? m_control.is_advance->read()
+                                  : m_next->read().is_advance()};
+            bool const is_valid  {(m_prior == nullptr)
+                                  ? m_control.is_valid->read()
+                                  : m_prior->read().is_valid()};
+
+            bus.write(model::control_in_t::pack(m_control.reset->read(),
+                                                is_advance,
+                                                m_control.is_flush->read(),
+                                                is_valid));
+          }
+
+        private:  // local types and declarations
+          using SC_CURRENT_USER_MODULE = link_t;
+
+        private:  // attributes
+          control_t                          &m_control;
+          model::signal::control_out_t const *m_prior;   // prior stage; or none
+          model::signal::control_out_t const *m_next;    // next stage; or none
+      };
+#endif
+
+    private:  // attributes
+      ::std::vector<::std::unique_ptr<stage_t>> m_stage;  // head to tail
+#if  defined(MODEL_CONTROL_PACKED)
+      control_t                                 m_control;
+      ::std::vector<::std::unique_ptr<link_t>>  m_link;   // one per stage
+#endif
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__EXAMPLE_SINGLE_CYCLE_PIPELINE_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,161 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  EXAMPLE/single_cycle_tlm.h
+//  - loosely-timed TLM-2.0 target wrapping the single_cycle cycle model.
+//  - one b_transport call is one clock cycle of the module.
+//
+//  Design Decisions:
+//  - the payload is the monitor's transaction data,
+//    ::transaction::single_cycle_signals_t, carried by the generic
+//    payload's data pointer; the initiator writes the stimuli, and the
+//    target fills in the state before (state_0) and after (state_1) the
+//    cycle.  A transported payload is a complete transaction; the
+//    predictors check it unchanged.
+//  - the target steps ::EXAMPLE::single_cycle_model_t, as the pin-level
+//    module and the native vif do; all three execute identical logic.
+//  - each transport annotates one clock period onto the delay; the
+//    initiator's quantum keeper decides when to sync with the kernel.
+//  - the payload carries no debug string; the cycle model is clocked with
+//    the empty label.
+//
+//  NOTES:
+//  2026-10-16: created.
+//  2026-10-16: restore(...) sets the module state from a checkpoint.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__EXAMPLE_SINGLE_CYCLE_TLM_H__)
+# define __EXAMPLE_SINGLE_CYCLE_TLM_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+  // <none>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+# include "TLM.h"
+# include "model.h"
+# include "EXAMPLE/single_cycle_model.h"
+# include "UVM/transaction.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+  namespace EXAMPLE
+  {
+    class single_cycle_tlm_t;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+  class EXAMPLE::single_cycle_tlm_t final : public SC::module
+  {
+    private:  // forward declarations and type aliases
+      using cycle_model_t = ::EXAMPLE::single_cycle_model_t;
+      using cycle_input_t = cycle_model_t::input_t;
+      using cycle_state_t = cycle_model_t::state_t;
+
+    public:   // forward declarations and type aliases
+      using payload_t = ::transaction::single_cycle_signals_t;
+
+    public:    // c'tor and d'tor
+      single_cycle_tlm_t(SC::module_name const &name,
+                         SC::time const        &clock_period)
+        : SC::module{name}
+        , socket{"socket"}
+        , m_clock_period{clock_period}
+        , m_state{}
+      {
+        socket.register_b_transport(this, &single_cycle_tlm_t::b_transport);
+      }
+
+    public:   // methods
+      void restore(cycle_state_t const &state)
+      { // restore the module state; NB: between transports
+        m_state = state;
+      }
+
+    public:   // attributes
+      TLM::target_socket<single_cycle_tlm_t> socket;  // bound by the vif
+
+    private:  // methods
+      void b_transport(TLM::generic_payload &payload, SC::time &delay)
+      { // clock the module once with the payload's stimuli.
+        // NB: never waits; time passes as annotated delay.
+        if  ((payload.get_command() != TLM::write_command) or
+             (payload.get_data_length() != sizeof(payload_t)))
+        {
+          payload.set_response_status(TLM::command_error_response);
+          return;
+        }
+
+        auto &signals{*static_cast<payload_t *>(
+                         static_cast<void *>(payload.get_data_ptr()))};
+        auto const &stimuli{signals.stimuli};
+
+        cycle_input_t const input
+        {
+          stimuli.ctl.reset,
+          stimuli.ctl.is_advance,
+          stimuli.ctl.is_flush,
+          stimuli.ctl.is_valid,
+          stimuli.data.value,
+          stimuli.debug.i_binary,
+          stimuli.debug.i_number,
+          stimuli.debug.is_error,
+          {},                      // NB: no debug string in the payload
+        };
+
+        //--the state before, the cycle, and the state after
+        signals.state_0 = output(m_state);
+        m_state.is_advance = cycle_model_t::advance(m_state.is_stall,
+                                                    m_state.is_valid,
+                                                    input.is_advance);
+        cycle_model_t::cycle(input, m_state);
+        signals.state_1 = output(m_state);
+
+        delay += m_clock_period;
+        payload.set_response_status(TLM::ok_response);
+      }
+
+      static payload_t::mut_output_state_t output(cycle_state_t const &state)
+      { // the module outputs for the given state, as the monitor samples
+        // them; see: ::monitor::EXAMPLE::single_cycle_t::sample_state()
+        return
+        {
+          {state.is_advance, state.is_error, state.is_stall, state.is_valid},
+          {state.value},
+          {state.i_binary, state.i_number, state.is_advance},
+        };
+      }
+
+    private:  // attributes
+      SC::time      m_clock_period;  // delay annotated per transport
+      cycle_state_t m_state;         // state clocked at the last transport
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__EXAMPLE_SINGLE_CYCLE_TLM_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
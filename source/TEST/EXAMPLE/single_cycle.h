@@ -113,10 +113,10 @@
         return  m_mut_data.out;
       }
 
-      void debug_in(model::signal::i_number_t   &i_number,
-                    model::signal::i_binary_t   &i_binary,
-                    model::signal::is_advance_t &is_advance,
-                    SC::signal<std::string>     &string)
+      void debug_in(model::signal::i_number_t     &i_number,
+                    model::signal::i_binary_t     &i_binary,
+                    model::signal::is_advance_t   &is_advance,
+                    model::signal::debug_string_t &string)
       { // bind input debug signals to and from the module under test
         m_mut_debug.in.i_number.bind(i_number);
         m_mut_debug.in.i_binary.bind(i_binary);
@@ -528,24 +528,24 @@
       { // module under test debug signals
         struct in_t
         {
-          model::port::in::i_number_t   i_number;
-          model::port::in::i_binary_t   i_binary;
-          model::port::in::is_advance_t is_advance;
-          SC::in<std::string>           string;
+          model::port::in::i_number_t     i_number;
+          model::port::in::i_binary_t     i_binary;
+          model::port::in::is_advance_t   is_advance;
+          model::port::in::debug_string_t string;
         };
         struct out_t
         {
-          model::exprt::i_number_t i_number;
-          model::exprt::i_binary_t i_binary;
-          model::exprt::is_error_t is_error;
-          SC::exprt<SC::signal<std::string>> string;
+          model::exprt::i_number_t     i_number;
+          model::exprt::i_binary_t     i_binary;
+          model::exprt::is_error_t     is_error;
+          model::exprt::debug_string_t string;
         };
         struct signal_t
         {
-          model::signal::i_number_t i_number;
-          model::signal::i_binary_t i_binary;
-          model::signal::is_error_t is_error;
-          SC::signal<std::string>   string;
+          model::signal::i_number_t     i_number;
+          model::signal::i_binary_t     i_binary;
+          model::signal::is_error_t     is_error;
+          model::signal::debug_string_t string;
         };
 
         in_t     in;       // input ports for signals from module under test
@@ -0,0 +1,65 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  abi-EXAMPLE-single_cycle.cpp
+//  - the C ABI entry point of the UVM test, when built as a shared object;
+//    see: testbench.h, launch-EXAMPLE-single_cycle.cpp.
+//  - linked with uvm-EXAMPLE-single_cycle.cpp, whose sc_main is run by
+//    the SystemC kernel copy in the same shared object.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "testbench.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+extern "C" int testbench_run(testbench_result_t *const result,
+                             int const                 argc,
+                             char **const              argv)
+{ // elaborate and simulate once, as the SystemC main() would.
+  // NB: the caller owns result, argv, and the strings of argv.
+  auto const start{::std::chrono::steady_clock::now()};
+
+  int return_code{::testbench::exception};
+  try
+  {
+    return_code = ::sc_core::sc_elab_and_sim(argc, argv);
+  }
+  catch  (...)
+  { /* noOp; NB: no exception crosses the ABI */ }
+
+  auto const stop{::std::chrono::steady_clock::now()};
+
+  result->return_code = return_code;
+  result->seconds     = ::std::chrono::duration<double>{stop - start}.count();
+
+  //--end of compilation unit with explicit return
+  return  return_code;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
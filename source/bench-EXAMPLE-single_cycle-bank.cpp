@@ -0,0 +1,218 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-bank.cpp
+//  - benchmark: 64 scalar cycle models versus one bit-sliced bank.
+//  - clocks 64 independent instances of the example single_cycle cycle
+//    model, each from its own random stimulus stream, for the same 1M
+//    cycle run as the UVM test; no kernel, no signals, no processes.
+//  - checks the bank against the scalar models, lane by lane, after
+//    every block of stimuli.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-bank
+//
+//  OUTPUT:
+//    one line per model kind: instance-cycles, wall-clock seconds, ns per
+//    instance-cycle; then the lanes found to differ, if any.
+//    NB: the stimuli are generated, and packed, before the clock starts.
+//
+//  BUILD OPTIONS:
+//    MODEL_NO_DEBUG_STRING: when defined, the scalar models carry no
+//      debug strings; see: ::model::debug_string_t.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: the bank and the scalar models differ.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "model.h"
+
+#include "EXAMPLE/single_cycle_bank.h"
+#include "EXAMPLE/single_cycle_model.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  using bank_t  = ::EXAMPLE::single_cycle_bank_t;
+  using model_t = ::EXAMPLE::single_cycle_model_t;
+
+  auto constexpr lanes{bank_t::lanes};
+
+  using lane_inputs_t = ::std::array<model_t::input_t, lanes>;
+  using lane_states_t = ::std::array<model_t::state_t, lanes>;
+
+  //--one block of stimuli; in both forms
+  struct stimuli_t
+  {
+    ::std::vector<lane_inputs_t>   scalar;
+    ::std::vector<bank_t::input_t> bank;
+  };
+
+  stimuli_t generate(::std::size_t const cycles)
+  { // random stimuli; one stream per lane.
+    // NB: reset is rare, as are flush and error.
+    ::std::vector<::std::mt19937_64> stream{};
+    for  (::std::size_t ix{0}; ix < lanes; ++ix)
+      stream.emplace_back(::std::mt19937_64::default_seed + ix);
+
+    stimuli_t stimuli{{}, {}};
+    stimuli.scalar.reserve(cycles);
+    stimuli.bank.reserve(cycles);
+    for  (::std::size_t cx{0}; cx < cycles; ++cx)
+    {
+      lane_inputs_t   inputs{};
+      bank_t::input_t packed{};
+      for  (::std::size_t ix{0}; ix < lanes; ++ix)
+      {
+        auto const bits{stream[ix]()};
+        inputs[ix] =
+        {
+          ((bits bitand 0x3Fu) != 0),                   // reset
+          ((bits bitand 0x40u) != 0),                   // is_advance
+          ((bits bitand 0x780u) == 0),                  // is_flush
+          ((bits bitand 0x800u) != 0),                  // is_valid
+          static_cast<model::value_t>(bits >> 32),      // value
+          static_cast<model::i_binary_t>(bits >> 24),   // i_binary
+          static_cast<model::i_number_t>(cx),           // i_number
+          ((bits bitand 0xFF000u) == 0),                // is_error
+          {},                                           // string
+        };
+        bank_t::lane(packed, ix, inputs[ix]);
+      }
+      stimuli.scalar.push_back(inputs);
+      stimuli.bank.push_back(packed);
+    }
+    return  stimuli;
+  }
+
+  void cycle(lane_inputs_t const &inputs, lane_states_t &states)
+  { // clock each scalar model once; as per the native vif
+    for  (::std::size_t ix{0}; ix < lanes; ++ix)
+    {
+      auto &state{states[ix]};
+      state.is_advance = model_t::advance(state.is_stall,
+                                          state.is_valid,
+                                          inputs[ix].is_advance);
+      model_t::cycle(inputs[ix], state);
+    }
+  }
+
+  void cycle(bank_t::input_t const &input, bank_t::state_t &state)
+  { // clock every lane of the bank once
+    state.is_advance = bank_t::advance(state.is_stall,
+                                       state.is_valid,
+                                       input.is_advance);
+    bank_t::cycle(input, state);
+  }
+
+  template<typename INPUT_T, typename STATE_T>
+  double run(::std::vector<INPUT_T> const &block, STATE_T &state)
+  { // clock the given block of stimuli; returns wall-clock seconds
+    auto const start{::std::chrono::steady_clock::now()};
+    for  (auto const &input: block)
+      cycle(input, state);
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    return  ::std::chrono::duration<double>{stop - start}.count();
+  }
+
+  ::std::size_t differences(lane_states_t const   &scalar,
+                            bank_t::state_t const &bank)
+  { // lanes whose states differ, debug strings excluded
+    ::std::size_t count{0};
+    for  (::std::size_t ix{0}; ix < lanes; ++ix)
+    {
+      auto expected{scalar[ix]};
+      expected.string = {};
+      if  (not (bank_t::lane(bank, ix) == expected))
+        count = (count + 1);
+    }
+    return  count;
+  }
+
+  void report(char const *const   kind,
+              ::std::size_t const cycles,
+              double const        seconds)
+  {
+    double const instance_cycles{static_cast<double>(cycles * lanes)};
+    ::std::cout << kind
+                << " instance-cycles: " << (cycles * lanes)
+                << " seconds: " << seconds
+                << " ns/instance-cycle: " << ((seconds * 1.0e9) / instance_cycles)
+                << ::std::endl;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const,
+            char **const)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  ::std::size_t const block_cycles{1024};
+  ::std::size_t const blocks      {1000};
+
+  auto const stimuli{generate(block_cycles)};
+
+  //--NB: each block starts from the state the prior block left
+  lane_states_t   scalar{};
+  bank_t::state_t bank{};
+  double          scalar_seconds{0.0};
+  double          bank_seconds{0.0};
+  ::std::size_t   differ{0};
+  for  (::std::size_t bx{0}; bx < blocks; ++bx)
+  {
+    scalar_seconds = (scalar_seconds + run(stimuli.scalar, scalar));
+    bank_seconds   = (bank_seconds   + run(stimuli.bank,   bank));
+    differ         = differences(scalar, bank);
+    if  (differ != 0)
+      break;
+  }
+
+  report("scalar", (block_cycles * blocks), scalar_seconds);
+  report("bank",   (block_cycles * blocks), bank_seconds);
+  if  (differ != 0)
+  {
+    ::std::cerr << "lanes differ: " << differ << ::std::endl;
+    return  1;
+  }
+
+  //--end of compilation unit with explicit return
+  return  0;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
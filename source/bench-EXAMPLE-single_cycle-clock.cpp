@@ -0,0 +1,219 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-clock.cpp
+//  - benchmark: free-running sc_clock versus the cycle-stepped clock.
+//  - clocks the example single_cycle module, driven by a trivial
+//    stimulus process, for the same 1M cycle run as the UVM test.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-clock [sc_clock | cycle_clock]
+//
+//  OUTPUT:
+//    one line: clock kind, cycles, delta cycles, wall-clock seconds.
+//    NB: SystemC counts one delta cycle per evaluate/update round; the
+//        sc_clock costs two timed rounds plus a delta round per cycle,
+//        the cycle clock one round per cycle.
+//
+//  BUILD OPTIONS:
+//    MODEL_CONTROL_PACKED: when defined, the control inputs are driven
+//      as one packed channel; see: ::model::control_in_t.
+//    MODEL_NO_DEBUG_STRING: when defined, the MUT has no debug string
+//      channels; see: ::model::debug_string_t.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: unknown clock kind.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "model.h"
+
+#include "clocking.h"
+#include "EXAMPLE/single_cycle.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--trivial stimulus; one new input datum per active edge
+  class stimulus_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      stimulus_t(SC::module_name name, model::signal::clock_if_t &clock)
+        : SC::module{name}
+#if  defined(MODEL_CONTROL_PACKED)
+        , control{"control"}
+#else
+        , reset{"reset"}
+        , is_advance{"is_advance"}
+        , is_flush{"is_flush"}
+        , is_valid{"is_valid"}
+#endif
+        , value{"value"}
+        , i_number{"i_number"}
+        , i_binary{"i_binary"}
+        , is_error{"is_error"}
+#if  not defined(MODEL_NO_DEBUG_STRING)
+        , string{"string"}
+#endif
+        , m_count{0}
+      {
+        SC_METHOD(edge);
+        sensitive << clock.posedge_event();
+        dont_initialize();
+      }
+
+    public:   // accessors
+      ::std::uint64_t count() const
+      { return  m_count; }
+
+    public:   // attributes
+#if  defined(MODEL_CONTROL_PACKED)
+      model::signal::control_in_t   control;
+#else
+      model::signal::reset_t        reset;
+      model::signal::is_advance_t   is_advance;
+      model::signal::is_flush_t     is_flush;
+      model::signal::is_valid_t     is_valid;
+#endif
+      model::signal::value_t        value;
+      model::signal::i_number_t     i_number;
+      model::signal::i_binary_t     i_binary;
+      model::signal::is_error_t     is_error;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+      model::signal::debug_string_t string;
+#endif
+
+    private:  // methods
+      void edge()
+      {
+        m_count = (m_count + 1);
+#if  defined(MODEL_CONTROL_PACKED)
+        control.write(model::control_in_t::pack(true,
+                                                true,
+                                                false,
+                                                ((m_count bitand 1) == 1)));
+#else
+        reset.write(true);
+        is_advance.write(true);
+        is_valid.write((m_count bitand 1) == 1);
+#endif
+        value.write(static_cast<model::value_t>(m_count));
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = stimulus_t;
+
+    private:  // attributes
+      ::std::uint64_t m_count;
+  };
+
+  //--clocks the MUT; stimulus and MUT are sensitive to the same edge
+  int run(model::signal::clock_if_t &clock,
+          SC::time const            &run_time,
+          char const *const          kind)
+  {
+    EXAMPLE::single_cycle_t mut{"mut"};
+    stimulus_t              stimulus{"stimulus", clock};
+
+    mut.clock(clock);
+#if  defined(MODEL_CONTROL_PACKED)
+    mut.control_in(stimulus.control);
+#else
+    mut.control_in(stimulus.reset,
+                   stimulus.is_advance,
+                   stimulus.is_flush,
+                   stimulus.is_valid);
+#endif
+    mut.data_in   (stimulus.value);
+#if  defined(MODEL_NO_DEBUG_STRING)
+    mut.debug_in  (stimulus.i_number,
+                   stimulus.i_binary,
+                   stimulus.is_error);
+#else
+    mut.debug_in  (stimulus.i_number,
+                   stimulus.i_binary,
+                   stimulus.is_error,
+                   stimulus.string);
+#endif
+
+    auto const start{::std::chrono::steady_clock::now()};
+    SC::start(run_time);
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    ::std::cout << kind
+                << " cycles: " << stimulus.count()
+                << " deltas: " << SC::delta_count()
+                << " seconds: " << elapsed.count()
+                << ::std::endl;
+
+    return  0;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  SC::time const clock_period{1.0, SC::nsec};
+  double const   clock_duty  {0.5};
+  SC::time const clock_start {0.0, SC::nsec};
+
+  SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
+
+  ::std::string const kind{(argc > 1) ? argv[1] : "cycle_clock"};
+
+  if  (kind == "sc_clock")
+  {
+    model::signal::clock_t clock{"clock",
+                                 clock_period,
+                                 clock_duty,
+                                 clock_start};
+    return  run(clock, run_time, "sc_clock");
+  }
+  else if  (kind == "cycle_clock")
+  {
+    clocking::cycle_clock_t clock{"clock", clock_period};
+    return  run(clock, run_time, "cycle_clock");
+  }
+
+  ::std::cerr << "unknown clock kind: " << kind << ::std::endl;
+
+  //--end of compilation unit with explicit return
+  return  1;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
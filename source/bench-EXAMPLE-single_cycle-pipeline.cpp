@@ -0,0 +1,295 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-pipeline.cpp
+//  - benchmark: kernel cost as the depth of a pipeline grows.
+//  - elaborates one N-stage pipeline of the example single_cycle module
+//    on one cycle-stepped clock, for the same 1M cycle run as the UVM
+//    test; see: EXAMPLE/single_cycle_pipeline.h.
+//  - a head agent drives the pipeline's inputs, a valid datum every other
+//    cycle; a tail agent drives the advance to the tail, withheld every
+//    fourth cycle, and takes the data out.  The two share a score board;
+//    each datum taken out must be the one put in, inverted once per stage,
+//    in order.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-pipeline [N]
+//      N: the number of stages; the default is one.
+//    NB: a sweep is a shell loop, e.g.
+//        for n in 1 2 4 8 16 32 64; do bench-EXAMPLE-single_cycle-pipeline $n; done
+//
+//  OUTPUT:
+//    one line: stages, cycles, wall-clock seconds, cycles per second,
+//    stage-cycles per second, delta cycles per cycle, data taken out of
+//    the tail, and score board mismatches.
+//    NB: the withheld advance ripples from the tail towards the head one
+//        delta cycle per valid stage; delta cycles per cycle grow with N.
+//
+//  BUILD OPTIONS:
+//    MODEL_CONTROL_PACKED: when defined, each stage's control inputs are
+//      packed by a link process; one more delta cycle per stage.
+//    MODEL_NO_DEBUG_STRING: when defined, the stages have no debug string
+//      channels; see: ::model::debug_string_t.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: too few stages.
+//    2: the score board found a mismatch, or no datum came out.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "model.h"
+
+#include "clocking.h"
+#include "EXAMPLE/single_cycle_pipeline.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  using pipeline_t = ::EXAMPLE::single_cycle_pipeline_t;
+
+  //--data put into the head, not yet taken out of the tail; in order
+  using score_board_t = ::std::deque<model::value_t>;
+
+  //--drives the pipeline's inputs; one new input datum per active edge
+  class head_agent_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      head_agent_t(SC::module_name            name,
+                   model::signal::clock_if_t &clock,
+                   pipeline_t                &pipeline,
+                   score_board_t             &score_board)
+        : SC::module{name}
+        , reset{"reset"}
+        , is_flush{"is_flush"}
+        , is_valid{"is_valid"}
+        , value{"value"}
+        , i_number{"i_number"}
+        , i_binary{"i_binary"}
+        , is_error{"is_error"}
+#if  not defined(MODEL_NO_DEBUG_STRING)
+        , string{"string"}
+#endif
+        , m_pipeline{pipeline}
+        , m_score_board{score_board}
+        , m_count{0}
+      {
+        SC_METHOD(drive);
+        sensitive << clock.posedge_event();
+        dont_initialize();
+      }
+
+    public:   // attributes
+      model::signal::reset_t        reset;
+      model::signal::is_flush_t     is_flush;
+      model::signal::is_valid_t     is_valid;
+      model::signal::value_t        value;
+      model::signal::i_number_t     i_number;
+      model::signal::i_binary_t     i_binary;
+      model::signal::is_error_t     is_error;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+      model::signal::debug_string_t string;
+#endif
+
+    private:  // methods
+      void drive()
+      {
+        //--the head takes the datum driven at the last edge, if it advances
+        //--NB: reads see the values the head stage sees at this edge
+        if  (reset.read() and (not is_flush.read()) and
+             is_valid.read() and m_pipeline.is_advance())
+          m_score_board.push_back(value.read());
+
+        //--the next datum
+        m_count = (m_count + 1);
+        reset.write(true);
+        is_valid.write((m_count bitand 1) == 1);
+        value.write(static_cast<model::value_t>(m_count));
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = head_agent_t;
+
+    private:  // attributes
+      pipeline_t      &m_pipeline;
+      score_board_t   &m_score_board;
+      ::std::uint64_t  m_count;
+  };
+
+  //--drives the advance to the tail; takes data out of the tail
+  class tail_agent_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      tail_agent_t(SC::module_name            name,
+                   model::signal::clock_if_t &clock,
+                   pipeline_t                &pipeline,
+                   score_board_t             &score_board)
+        : SC::module{name}
+        , is_advance{"is_advance"}
+        , m_pipeline{pipeline}
+        , m_score_board{score_board}
+        , m_is_inverted{(pipeline.depth() % 2) == 1}
+        , m_count{0}
+        , m_taken{0}
+        , m_mismatches{0}
+      {
+        SC_METHOD(take);
+        sensitive << clock.posedge_event();
+        dont_initialize();
+      }
+
+    public:   // accessors
+      ::std::uint64_t taken() const
+      { return  m_taken; }
+
+      ::std::uint64_t mismatches() const
+      { return  m_mismatches; }
+
+    public:   // attributes
+      model::signal::is_advance_t is_advance;
+
+    private:  // methods
+      void take()
+      {
+        //--the tail gives up its datum when valid and advanced
+        //--NB: the agent never resets the pipeline once it is running
+        if  (m_pipeline.is_valid() and is_advance.read())
+        {
+          m_taken = (m_taken + 1);
+          if  (m_score_board.empty())
+            m_mismatches = (m_mismatches + 1);
+          else
+          {
+            model::value_t const expected{m_is_inverted
+                                          ? model::value_t{compl m_score_board.front()}
+                                          : m_score_board.front()};
+            if  (m_pipeline.value() != expected)
+              m_mismatches = (m_mismatches + 1);
+            m_score_board.pop_front();
+          }
+        }
+
+        //--withhold the advance every fourth cycle
+        m_count = (m_count + 1);
+        is_advance.write((m_count % 4) != 0);
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = tail_agent_t;
+
+    private:  // attributes
+      pipeline_t      &m_pipeline;
+      score_board_t   &m_score_board;
+      bool const       m_is_inverted;  // an odd number of stages
+      ::std::uint64_t  m_count;
+      ::std::uint64_t  m_taken;
+      ::std::uint64_t  m_mismatches;
+  };
+
+  //--clocks an N-stage pipeline between its head and tail agents
+  int run(SC::time const     &clock_period,
+          SC::time const     &run_time,
+          ::std::size_t const depth)
+  {
+    clocking::cycle_clock_t clock{"clock", clock_period};
+    score_board_t           score_board{};
+
+    pipeline_t   pipeline{"pipeline", depth};
+    head_agent_t head    {"head", clock, pipeline, score_board};
+    tail_agent_t tail    {"tail", clock, pipeline, score_board};
+
+    pipeline.clock     (clock);
+    pipeline.control_in(head.reset,
+                        tail.is_advance,
+                        head.is_flush,
+                        head.is_valid);
+    pipeline.data_in   (head.value);
+#if  defined(MODEL_NO_DEBUG_STRING)
+    pipeline.debug_in  (head.i_number,
+                        head.i_binary,
+                        head.is_error);
+#else
+    pipeline.debug_in  (head.i_number,
+                        head.i_binary,
+                        head.is_error,
+                        head.string);
+#endif
+
+    auto const deltas_0{SC::delta_count()};
+    auto const start{::std::chrono::steady_clock::now()};
+    SC::start(run_time);
+    auto const stop{::std::chrono::steady_clock::now()};
+    auto const deltas{SC::delta_count() - deltas_0};
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    double const cycles{static_cast<double>(clock.edge_count())};
+    double const stage_cycles{cycles * static_cast<double>(depth)};
+    ::std::cout << "stages: " << depth
+                << " cycles: " << clock.edge_count()
+                << " seconds: " << elapsed.count()
+                << " cycles/s: " << (cycles / elapsed.count())
+                << " stage-cycles/s: " << (stage_cycles / elapsed.count())
+                << " deltas/cycle: " << (static_cast<double>(deltas) / cycles)
+                << " taken: " << tail.taken()
+                << " mismatches: " << tail.mismatches()
+                << ::std::endl;
+
+    return  ((tail.mismatches() == 0) and (tail.taken() > 0)) ? 0 : 2;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  SC::time const clock_period{1.0, SC::nsec};
+
+  SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
+
+  ::std::size_t const depth{(argc > 1) ? ::std::stoul(argv[1]) : 1};
+
+  if  (depth < 1)
+    ::std::cerr << "too few stages: " << depth << ::std::endl;
+  else
+    return  run(clock_period, run_time, depth);
+
+  //--end of compilation unit with explicit return
+  return  1;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
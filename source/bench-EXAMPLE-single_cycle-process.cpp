@@ -0,0 +1,248 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-process.cpp
+//  - benchmark: thread versus method processes for stimulus and sampling.
+//  - clocks the example single_cycle module on the cycle-stepped clock,
+//    for the same 1M cycle run as the UVM test; a stimulus process drives
+//    the inputs and a sampling process reads the outputs every cycle, as
+//    the driver and monitor do.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-process [thread | method]
+//
+//  OUTPUT:
+//    one line: process kind, cycles, wall-clock seconds, ns per cycle.
+//    NB: a thread process costs a coroutine context switch in and out per
+//        activation; a method process is a plain function call.
+//
+//  BUILD OPTIONS:
+//    MODEL_NO_DEBUG_STRING: when defined, the MUT has no debug string
+//      channels; see: ::model::debug_string_t.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: unknown process kind.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "model.h"
+
+#include "clocking.h"
+#include "EXAMPLE/single_cycle.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--trivial stimulus and sampling; one new input datum per active edge
+  class stimulus_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      stimulus_t(SC::module_name                   name,
+                 model::signal::clock_if_t        &clock,
+                 model::exprt::value_t            &sample,
+                 bool const                        is_method)
+        : SC::module{name}
+        , reset{"reset"}
+        , is_advance{"is_advance"}
+        , is_flush{"is_flush"}
+        , is_valid{"is_valid"}
+        , value{"value"}
+        , i_number{"i_number"}
+        , i_binary{"i_binary"}
+        , is_error{"is_error"}
+#if  not defined(MODEL_NO_DEBUG_STRING)
+        , string{"string"}
+#endif
+        , m_clock{clock}
+        , m_sample{sample}
+        , m_count{0}
+        , m_checksum{0}
+      {
+        if  (is_method)
+        {
+          SC_METHOD(drive_method);
+          sensitive << clock.posedge_event();
+          dont_initialize();
+
+          SC_METHOD(sample_method);
+          sensitive << clock.posedge_event();
+          dont_initialize();
+        }
+        else
+        {
+          SC_THREAD(drive_thread);
+          SC_THREAD(sample_thread);
+        }
+      }
+
+    public:   // accessors
+      ::std::uint64_t count() const
+      { return  m_count; }
+
+      ::std::uint64_t checksum() const
+      { return  m_checksum; }
+
+    public:   // attributes
+      model::signal::reset_t        reset;
+      model::signal::is_advance_t   is_advance;
+      model::signal::is_flush_t     is_flush;
+      model::signal::is_valid_t     is_valid;
+      model::signal::value_t        value;
+      model::signal::i_number_t     i_number;
+      model::signal::i_binary_t     i_binary;
+      model::signal::is_error_t     is_error;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+      model::signal::debug_string_t string;
+#endif
+
+    private:  // methods
+      void drive()
+      {
+        m_count = (m_count + 1);
+        reset.write(true);
+        is_advance.write(true);
+        is_valid.write((m_count bitand 1) == 1);
+        value.write(static_cast<model::value_t>(m_count));
+      }
+
+      void sample()
+      { // NB: the checksum keeps the reads observable
+        m_checksum = (m_checksum + m_sample->read());
+      }
+
+      void drive_method()
+      { drive(); }
+
+      void sample_method()
+      { sample(); }
+
+      void drive_thread()
+      {
+        while  (true)
+        {
+          wait(m_clock.posedge_event());
+          drive();
+        }
+      }
+
+      void sample_thread()
+      {
+        while  (true)
+        {
+          wait(m_clock.posedge_event());
+          sample();
+        }
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = stimulus_t;
+
+    private:  // attributes
+      model::signal::clock_if_t        &m_clock;
+      model::exprt::value_t            &m_sample;
+      ::std::uint64_t                   m_count;
+      ::std::uint64_t                   m_checksum;
+  };
+
+  //--clocks the MUT; stimulus, sampling, and MUT share the same edge
+  int run(SC::time const   &clock_period,
+          SC::time const   &run_time,
+          bool const        is_method,
+          char const *const kind)
+  {
+    clocking::cycle_clock_t clock{"clock", clock_period};
+    EXAMPLE::single_cycle_t mut{"mut"};
+    stimulus_t              stimulus{"stimulus",
+                                     clock,
+                                     mut.data_out().value,
+                                     is_method};
+
+    mut.clock(clock);
+    mut.control_in(stimulus.reset,
+                   stimulus.is_advance,
+                   stimulus.is_flush,
+                   stimulus.is_valid);
+    mut.data_in   (stimulus.value);
+#if  defined(MODEL_NO_DEBUG_STRING)
+    mut.debug_in  (stimulus.i_number,
+                   stimulus.i_binary,
+                   stimulus.is_error);
+#else
+    mut.debug_in  (stimulus.i_number,
+                   stimulus.i_binary,
+                   stimulus.is_error,
+                   stimulus.string);
+#endif
+
+    auto const start{::std::chrono::steady_clock::now()};
+    SC::start(run_time);
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    double const cycles{static_cast<double>(stimulus.count())};
+    ::std::cout << kind
+                << " cycles: " << stimulus.count()
+                << " seconds: " << elapsed.count()
+                << " ns/cycle: " << ((elapsed.count() * 1.0e9) / cycles)
+                << " checksum: " << stimulus.checksum()
+                << ::std::endl;
+
+    return  0;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  SC::time const clock_period{1.0, SC::nsec};
+
+  SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
+
+  ::std::string const kind{(argc > 1) ? argv[1] : "method"};
+
+  if  (kind == "thread")
+    return  run(clock_period, run_time, false, "thread");
+  else if  (kind == "method")
+    return  run(clock_period, run_time, true, "method");
+
+  ::std::cerr << "unknown process kind: " << kind << ::std::endl;
+
+  //--end of compilation unit with explicit return
+  return  1;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
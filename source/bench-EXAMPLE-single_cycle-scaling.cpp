@@ -0,0 +1,292 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-scaling.cpp
+//  - benchmark: kernel cost as the number of replicated instances grows.
+//  - elaborates N instances of the example single_cycle module on one
+//    cycle-stepped clock, each with its own stimulus and sampling
+//    processes, for the same 1M cycle run as the UVM test.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-scaling [N [thread | method]]
+//      N: the number of instances; the default is one.
+//    NB: a sweep is a shell loop, e.g.
+//        for n in 1 2 4 8 16 32 64; do bench-EXAMPLE-single_cycle-scaling $n; done
+//
+//  OUTPUT:
+//    one line: process kind, instances, cycles, wall-clock seconds,
+//    cycles per second, instance-cycles per second, ns per instance-cycle.
+//    NB: the clock's cost is paid once per cycle, whatever N; the
+//        processes' and signals' costs are paid once per instance-cycle.
+//
+//  BUILD OPTIONS:
+//    MODEL_NO_DEBUG_STRING: when defined, the MUT has no debug string
+//      channels; see: ::model::debug_string_t.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: unknown process kind, or too few instances.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "model.h"
+
+#include "clocking.h"
+#include "EXAMPLE/single_cycle.h"
+#include "utility.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--trivial stimulus and sampling; one new input datum per active edge;
+  //--one per instance
+  class stimulus_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      stimulus_t(SC::module_name                   name,
+                 model::signal::clock_if_t        &clock,
+                 model::exprt::value_t            &sample,
+                 bool const                        is_method)
+        : SC::module{name}
+        , reset{"reset"}
+        , is_advance{"is_advance"}
+        , is_flush{"is_flush"}
+        , is_valid{"is_valid"}
+        , value{"value"}
+        , i_number{"i_number"}
+        , i_binary{"i_binary"}
+        , is_error{"is_error"}
+#if  not defined(MODEL_NO_DEBUG_STRING)
+        , string{"string"}
+#endif
+        , m_clock{clock}
+        , m_sample{sample}
+        , m_count{0}
+        , m_checksum{0}
+      {
+        if  (is_method)
+        {
+          SC_METHOD(drive_method);
+          sensitive << clock.posedge_event();
+          dont_initialize();
+
+          SC_METHOD(sample_method);
+          sensitive << clock.posedge_event();
+          dont_initialize();
+        }
+        else
+        {
+          SC_THREAD(drive_thread);
+          SC_THREAD(sample_thread);
+        }
+      }
+
+    public:   // accessors
+      ::std::uint64_t count() const
+      { return  m_count; }
+
+      ::std::uint64_t checksum() const
+      { return  m_checksum; }
+
+    public:   // attributes
+      model::signal::reset_t        reset;
+      model::signal::is_advance_t   is_advance;
+      model::signal::is_flush_t     is_flush;
+      model::signal::is_valid_t     is_valid;
+      model::signal::value_t        value;
+      model::signal::i_number_t     i_number;
+      model::signal::i_binary_t     i_binary;
+      model::signal::is_error_t     is_error;
+#if  not defined(MODEL_NO_DEBUG_STRING)
+      model::signal::debug_string_t string;
+#endif
+
+    private:  // methods
+      void drive()
+      {
+        m_count = (m_count + 1);
+        reset.write(true);
+        is_advance.write(true);
+        is_valid.write((m_count bitand 1) == 1);
+        value.write(static_cast<model::value_t>(m_count));
+      }
+
+      void sample()
+      { // NB: the checksum keeps the reads observable
+        m_checksum = (m_checksum + m_sample->read());
+      }
+
+      void drive_method()
+      { drive(); }
+
+      void sample_method()
+      { sample(); }
+
+      void drive_thread()
+      {
+        while  (true)
+        {
+          wait(m_clock.posedge_event());
+          drive();
+        }
+      }
+
+      void sample_thread()
+      {
+        while  (true)
+        {
+          wait(m_clock.posedge_event());
+          sample();
+        }
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = stimulus_t;
+
+    private:  // attributes
+      model::signal::clock_if_t        &m_clock;
+      model::exprt::value_t            &m_sample;
+      ::std::uint64_t                   m_count;
+      ::std::uint64_t                   m_checksum;
+  };
+
+  //--one replicated instance: the MUT and its stimulus
+  class instance_t final
+  {
+    public:   // c'tors and d'tor
+      instance_t(unsigned const             index,
+                 model::signal::clock_if_t &clock,
+                 bool const                 is_method)
+        : mut{::utility::format::indexed("mut", index).c_str()}
+        , stimulus{::utility::format::indexed("stimulus", index).c_str(),
+                   clock,
+                   mut.data_out().value,
+                   is_method}
+      {
+        mut.clock(clock);
+        mut.control_in(stimulus.reset,
+                       stimulus.is_advance,
+                       stimulus.is_flush,
+                       stimulus.is_valid);
+        mut.data_in   (stimulus.value);
+#if  defined(MODEL_NO_DEBUG_STRING)
+        mut.debug_in  (stimulus.i_number,
+                       stimulus.i_binary,
+                       stimulus.is_error);
+#else
+        mut.debug_in  (stimulus.i_number,
+                       stimulus.i_binary,
+                       stimulus.is_error,
+                       stimulus.string);
+#endif
+      }
+
+      instance_t(instance_t const &) = delete;
+      instance_t &operator=(instance_t const &) = delete;
+
+    public:   // attributes
+      EXAMPLE::single_cycle_t mut;
+      stimulus_t              stimulus;
+  };
+
+  //--clocks N MUTs; all stimulus, sampling, and MUTs share the same edge
+  int run(SC::time const   &clock_period,
+          SC::time const   &run_time,
+          unsigned const    instances,
+          bool const        is_method,
+          char const *const kind)
+  {
+    clocking::cycle_clock_t clock{"clock", clock_period};
+
+    ::std::vector<::std::unique_ptr<instance_t>> instance{};
+    for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+      instance.emplace_back(new instance_t{ix, clock, is_method});
+
+    auto const start{::std::chrono::steady_clock::now()};
+    SC::start(run_time);
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    //--NB: every instance runs the same stimulus; the checksum sums them
+    ::std::uint64_t checksum{0};
+    for  (auto const &each: instance)
+      checksum = (checksum + each->stimulus.checksum());
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    double const cycles{static_cast<double>(instance.front()->stimulus.count())};
+    double const instance_cycles{cycles * instances};
+    ::std::cout << kind
+                << " instances: " << instances
+                << " cycles: " << instance.front()->stimulus.count()
+                << " seconds: " << elapsed.count()
+                << " cycles/s: " << (cycles / elapsed.count())
+                << " instance-cycles/s: " << (instance_cycles / elapsed.count())
+                << " ns/instance-cycle: " << ((elapsed.count() * 1.0e9) / instance_cycles)
+                << " checksum: " << checksum
+                << ::std::endl;
+
+    return  0;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  SC::time const clock_period{1.0, SC::nsec};
+
+  SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
+
+  unsigned const      instances{(argc > 1)
+                                ? static_cast<unsigned>(::std::stoul(argv[1]))
+                                : 1u};
+  ::std::string const kind     {(argc > 2) ? argv[2] : "method"};
+
+  if  (instances < 1)
+    ::std::cerr << "too few instances: " << instances << ::std::endl;
+  else if  (kind == "thread")
+    return  run(clock_period, run_time, instances, false, "thread");
+  else if  (kind == "method")
+    return  run(clock_period, run_time, instances, true, "method");
+  else
+    ::std::cerr << "unknown process kind: " << kind << ::std::endl;
+
+  //--end of compilation unit with explicit return
+  return  1;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
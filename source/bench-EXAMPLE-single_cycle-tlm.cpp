@@ -0,0 +1,228 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-EXAMPLE-single_cycle-tlm.cpp
+//  - benchmark: pin-level vif versus the loosely-timed TLM-2.0 vif.
+//  - drives the example single_cycle module from a thread process through
+//    each vif, as the driver does, for the same 1M cycle run as the UVM
+//    test; the outputs are read back every cycle, as the monitor does.
+//
+//  USAGE:
+//    bench-EXAMPLE-single_cycle-tlm [pin | tlm]
+//
+//  OUTPUT:
+//    one line: vif kind, cycles, wall-clock seconds, ns per cycle.
+//    NB: the pin-level vif costs a context switch per cycle, and the
+//        MUT's signal updates; the TLM vif costs a function call per
+//        cycle, and a context switch per quantum.
+//
+//  RETURN CODES:
+//    0: success.
+//    1: unknown vif kind.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+#include "TLM.h"
+#include "model.h"
+
+#include "clocking.h"
+#include "EXAMPLE/single_cycle.h"
+#include "EXAMPLE/single_cycle_tlm.h"
+#include "UVM/vif.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  using pin_vif_t = ::vif::EXAMPLE::single_cycle_signal_t;
+  using tlm_vif_t = ::vif::EXAMPLE::single_cycle_tlm_t;
+
+  //--trivial stimulus and sampling; one new input datum per cycle
+  template<class VIF_T>
+  class stimulus_t final
+    : public SC::module
+  {
+    public:   // c'tors and d'tor
+      stimulus_t(SC::module_name name, VIF_T &vif)
+        : SC::module{name}
+        , m_vif{vif}
+        , m_count{0}
+        , m_checksum{0}
+      {
+        SC_THREAD(drive);
+      }
+
+    public:   // accessors
+      ::std::uint64_t count() const
+      { return  m_count; }
+
+      ::std::uint64_t checksum() const
+      { return  m_checksum; }
+
+    private:  // methods
+      void drive()
+      {
+        static ::model::debug_string_t const label{"BENCH"};
+
+        while  (true)
+        {
+          m_count = (m_count + 1);
+          m_vif.set_control_inputs(true,
+                                   true,
+                                   false,
+                                   ((m_count bitand 1) == 1));
+          m_vif.set_data_inputs(static_cast<model::value_t>(m_count));
+          m_vif.set_debug_inputs(0, 0, false, label);
+          cycle(m_vif);
+
+          //--NB: the checksum keeps the reads observable
+          m_checksum = (m_checksum + m_vif.out.data.value.read());
+        }
+      }
+
+      void cycle(pin_vif_t &vif)
+      { wait(vif.clock_posedge()); }
+
+      void cycle(tlm_vif_t &vif)
+      { vif.transport(); }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = stimulus_t;
+
+    private:  // attributes
+      VIF_T          &m_vif;
+      ::std::uint64_t m_count;
+      ::std::uint64_t m_checksum;
+  };
+
+  //--reports one run
+  template<class VIF_T>
+  int report(stimulus_t<VIF_T> const &stimulus,
+             SC::time const          &run_time,
+             char const *const        kind)
+  {
+    auto const start{::std::chrono::steady_clock::now()};
+    SC::start(run_time);
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    double const cycles{static_cast<double>(stimulus.count())};
+    ::std::cout << kind
+                << " cycles: " << stimulus.count()
+                << " seconds: " << elapsed.count()
+                << " ns/cycle: " << ((elapsed.count() * 1.0e9) / cycles)
+                << " checksum: " << stimulus.checksum()
+                << ::std::endl;
+
+    return  0;
+  }
+
+  //--clocks the MUT through the pin-level vif
+  int run_pin(SC::time const &clock_period, SC::time const &run_time)
+  {
+    clocking::cycle_clock_t clock{"clock", clock_period};
+    EXAMPLE::single_cycle_t mut{"mut"};
+
+    auto &control{mut.control_out()};
+    auto &data   {mut.data_out()   };
+    auto &debug  {mut.debug_out()  };
+
+    pin_vif_t vif
+    {
+      "vif",
+      clock,
+      control.is_advance,
+      control.is_error,
+      control.is_stall,
+      control.is_valid,
+      data.value,
+      debug.i_binary,
+      debug.i_number,
+      debug.is_advance,
+      debug.string
+    };
+
+    mut.clock(vif.in.clock.clock);
+    mut.control_in(vif.in.ctl.reset,
+                   vif.in.ctl.is_advance,
+                   vif.in.ctl.is_flush,
+                   vif.in.ctl.is_valid);
+    mut.data_in   (vif.in.data.value);
+    mut.debug_in  (vif.in.debug.i_number,
+                   vif.in.debug.i_binary,
+                   vif.in.debug.is_error,
+                   vif.in.debug.string);
+
+    stimulus_t<pin_vif_t> stimulus{"stimulus", vif};
+    return  report(stimulus, run_time, "pin");
+  }
+
+  //--transports to the target through the TLM vif
+  int run_tlm(SC::time const &clock_period,
+              SC::time const &run_time,
+              SC::time const &quantum)
+  {
+    TLM::set_global_quantum(quantum);
+
+    EXAMPLE::single_cycle_tlm_t mut{"mut", clock_period};
+    tlm_vif_t                   vif{"vif"};
+    vif.socket.bind(mut.socket);
+
+    stimulus_t<tlm_vif_t> stimulus{"stimulus", vif};
+    return  report(stimulus, run_time, "tlm");
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  //--run conditions; as per uvm-EXAMPLE-single_cycle.cpp
+  SC::time const clock_period{1.0, SC::nsec};
+  SC::time const quantum     {clock_period * 4096.0};
+
+  SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
+
+  ::std::string const kind{(argc > 1) ? argv[1] : "tlm"};
+
+  if  (kind == "pin")
+    return  run_pin(clock_period, run_time);
+  else if  (kind == "tlm")
+    return  run_tlm(clock_period, run_time, quantum);
+
+  ::std::cerr << "unknown vif kind: " << kind << ::std::endl;
+
+  //--end of compilation unit with explicit return
+  return  1;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,206 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-coverage-adaptive.cpp
+//  - benchmark: cycles to complete control input pair coverage; see:
+//    distribution.h, coverage.h, and sequence.h coverage_adaptive_t and
+//    coverage_holes_t.
+//  - draws the five control inputs once per cycle, and counts each pair
+//    of consecutive cycles, as the control_bit_pairs_t score board does;
+//    first with random_weighted_t's default weights, then adaptively,
+//    re-weighted from the counts at intervals.  No kernel, no UVM.
+//  - what the fixed weights leave open is then closed by a directed walk
+//    of the holes, as coverage_holes_t does.
+//
+//  USAGE:
+//    bench-coverage-adaptive [CYCLES] [INTERVAL] [SEEDS]
+//      CYCLES: the most cycles per run; the default is 100M.
+//      INTERVAL: cycles between adaptations; the default is 64.
+//      SEEDS: runs of each, one per seed from the default; the default
+//        is 8.
+//
+//  OUTPUT:
+//    one line per run: the pairs covered, of 1024, and the cycles taken
+//    to cover them all, or CYCLES, when not.  A directed line follows an
+//    incomplete fixed run: the pairs covered after its walk, and the
+//    walk's cycles.
+//
+//  RETURN CODES:
+//    0: success.
+//    2: an adaptive run, or a directed walk, did not complete its
+//       coverage.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <ranges>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "coverage.h"
+#include "distribution.h"
+#include "prng.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--as the score board: reset, is_advance, is_error, is_flush, is_valid,
+  //--  from bit 4 down to bit 0
+  ::std::size_t constexpr n_combinations{32};
+  using transition_t = ::distribution::transition_t<n_combinations>;
+  using alias_t      = ::distribution::alias_t<n_combinations>;
+
+  //--the pair counts; NB: large, not on the stack
+  struct coverage_t final
+  {
+    transition_t::counts_t counts;
+    unsigned               covered;
+
+    void observe(::std::size_t const prior, ::std::size_t const bits)
+    {
+      auto &count{counts[prior][bits]};
+      covered = (covered + ((count == 0) ? 1u : 0u));
+      count = (count + 1);
+    }
+  };
+
+  //--random_weighted_t's default weights, by the score board's bits
+  //--NB: its combinations are as request.h weights_t has them; reset is
+  //--    asserted low
+  alias_t fixed_weights()
+  {
+    alias_t::weights_t weights{};
+    for  (auto const bits: ::std::ranges::views::iota(::std::size_t{0}, n_combinations))
+    {
+      auto const p{[bits](::std::size_t const bit, double const asserted)
+      { return  ((bits bitand bit) != 0) ? asserted : (1.0 - asserted); }};
+      weights[bits] = (p(0x10, (1.0 - (1.0 / 256.0))) * p(0x08, (3.0 / 4.0)) *
+                       p(0x04, (1.0 / 1024.0)) * p(0x02, (1.0 / 64.0)) *
+                       p(0x01, (3.0 / 4.0)));
+    }
+    return  alias_t{weights};
+  }
+
+  //--reports one run
+  void report(char const *const     kind,
+              ::std::uint64_t const seed,
+              coverage_t const     &coverage,
+              ::std::uint64_t const cycles)
+  {
+    ::std::cout << kind
+                << " seed: " << seed
+                << " pairs: " << coverage.covered
+                << " cycles: " << cycles
+                << ::std::endl;
+  }
+
+  //--closes the given coverage by a directed walk; returns true when covered
+  bool run_directed(::std::uint64_t const seed,
+                    coverage_t           &coverage,
+                    ::std::size_t const   prior)
+  {
+    auto const walk{::coverage::hole_walk<n_combinations>(coverage.counts, prior)};
+    ::std::size_t at{prior};
+    for  (auto const bits: walk)
+    {
+      coverage.observe(at, bits);
+      at = bits;
+    }
+    report("directed", seed, coverage, walk.size());
+    return  (coverage.covered == (n_combinations * n_combinations));
+  }
+
+  //--runs until covered, or out of cycles; returns true when covered
+  //--NB: closed by a directed walk, when not
+  bool run_fixed(::std::uint64_t const seed,
+                 ::std::uint64_t const cycles)
+  {
+    ::prng::block_t<> engine{seed};
+    auto const distribution{fixed_weights()};
+    auto const coverage{::std::make_unique<coverage_t>()};
+
+    ::std::size_t prior{distribution(engine())};
+    ::std::uint64_t cycle{0};
+    while  ((coverage->covered < (n_combinations * n_combinations)) and (cycle < cycles))
+    {
+      auto const bits{distribution(engine())};
+      coverage->observe(prior, bits);
+      prior = bits;
+      cycle = (cycle + 1);
+    }
+    report("fixed", seed, *coverage, cycle);
+    if  (coverage->covered == (n_combinations * n_combinations))
+      return  true;
+    return  run_directed(seed, *coverage, prior);
+  }
+
+  bool run_adaptive(::std::uint64_t const seed,
+                    ::std::uint64_t const cycles,
+                    ::std::uint64_t const interval)
+  {
+    ::prng::block_t<> engine{seed};
+    auto const distribution{::std::make_unique<transition_t>()};
+    auto const coverage{::std::make_unique<coverage_t>()};
+
+    ::std::size_t prior{(*distribution)(engine())};
+    ::std::uint64_t cycle{0};
+    while  ((coverage->covered < (n_combinations * n_combinations)) and (cycle < cycles))
+    {
+      if  ((cycle % interval) == 0)
+        distribution->adapt(coverage->counts);
+      auto const bits{(*distribution)(engine())};
+      coverage->observe(prior, bits);
+      prior = bits;
+      cycle = (cycle + 1);
+    }
+    report("adaptive", seed, *coverage, cycle);
+    return  (coverage->covered == (n_combinations * n_combinations));
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int main(int const    argc,
+         char **const argv)
+{
+  ::std::uint64_t const cycles  {(argc > 1) ? ::std::stoull(argv[1]) : (100 * 1000 * 1000)};
+  ::std::uint64_t const interval{(argc > 2) ? ::std::stoull(argv[2]) : 64};
+  ::std::uint64_t const seeds   {(argc > 3) ? ::std::stoull(argv[3]) : 8};
+
+  bool is_complete{true};
+  auto const first{::prng::block_t<>::default_seed};
+  for  (auto const seed: ::std::ranges::views::iota(first, (first + seeds)))
+  {
+    is_complete = (run_fixed(seed, cycles) and is_complete);
+    is_complete = (run_adaptive(seed, cycles, ((interval > 0) ? interval : 1)) and is_complete);
+  }
+
+  //--end of compilation unit with explicit return
+  return  is_complete ? 0 : 2;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
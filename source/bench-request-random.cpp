@@ -0,0 +1,108 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-request-random.cpp
+//  - benchmark: the request random engines; see: prng.h, request.h.
+//  - draws two words per item, as random_weighted_t randomises, for
+//    each engine in turn; no kernel, no UVM.
+//
+//  USAGE:
+//    bench-request-random [ITEMS]
+//      ITEMS: the number of items; the default is 20M.
+//
+//  OUTPUT:
+//    one line per engine: words drawn, wall-clock seconds, ns per word,
+//    and a checksum, which keeps the draws observable.
+//    NB: time bench-request-random-optimised, built -O3; the build's
+//        CXXFLAGS have no -O.  With g++ 12.2, x86-64 baseline ISA, 20M
+//        items: mt19937_64 some 8-10 ns/word, xoshiro256** 1.5-1.8, and
+//        xoshiro256**-block 2.1.  With -march=native as well, on an
+//        AVX-512 host: 2.8, 2.0, and 1.2.  Unoptimised, the engines are
+//        20-50 ns/word, and rank in reverse.
+//    NB: xoshiro256** is the engine REQUEST_RANDOM_XOSHIRO selects; see:
+//        request.h.
+//
+//  RETURN CODES:
+//    0: success.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <ranges>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "prng.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--draws items from a default-seeded engine
+  template<class ENGINE_T>
+  void run(char const *const     kind,
+           ::std::uint64_t const items)
+  {
+    ENGINE_T engine{};
+
+    ::std::uint64_t checksum{0};
+    auto const start{::std::chrono::steady_clock::now()};
+    for  (auto const ix [[maybe_unused]]: ::std::ranges::views::iota(::std::uint64_t{0}, items))
+    { // control bits; i_binary and i_number
+      checksum = (checksum xor engine());
+      checksum = (checksum + engine());
+    }
+    auto const stop{::std::chrono::steady_clock::now()};
+
+    ::std::chrono::duration<double> const elapsed{stop - start};
+    double const words{2.0 * static_cast<double>(items)};
+    ::std::cout << kind
+                << " words: " << (2 * items)
+                << " seconds: " << elapsed.count()
+                << " ns/word: " << ((elapsed.count() * 1.0e9) / words)
+                << " checksum: " << checksum
+                << ::std::endl;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int main(int const    argc,
+         char **const argv)
+{
+  ::std::uint64_t const items{(argc > 1) ? ::std::stoull(argv[1])
+                                         : (20 * 1000 * 1000)};
+
+  run<::std::mt19937_64>("mt19937_64", items);
+  run<::prng::xoshiro256_t>("xoshiro256**", items);
+  run<::prng::block_t<>>("xoshiro256**-block", items);
+
+  //--end of compilation unit with explicit return
+  return  0;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
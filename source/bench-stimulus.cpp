@@ -0,0 +1,145 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  bench-stimulus.cpp
+//  - benchmark: stimulus file throughput; see: stimulus.h.
+//  - records N cycles of 16 byte records, as the single_cycle_t driver
+//    does, then maps the file and reads every record in place, twice; no
+//    kernel is run, no UVM.
+//
+//  USAGE:
+//    bench-stimulus [N] [PATH]
+//      N: the number of cycles; the default is 64M, a 1GiB file.
+//      PATH: the file; the default is /tmp/bench-stimulus.bin.  It is
+//        left in place.
+//
+//  OUTPUT:
+//    one line per pass: record, then each read; cycles, wall-clock
+//    seconds, GB/s, and a checksum, which keeps the reads observable.
+//    NB: the first read is cold only if the page cache is dropped first;
+//        e.g. echo 1 > /proc/sys/vm/drop_caches, as root.
+//
+//  RETURN CODES:
+//    0: success.
+//    2: a read disagreed with the record.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <ranges>
+#include <string>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "SC.h"
+
+#include "stimulus.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--as ::driver::EXAMPLE::single_cycle_t::stimulus_t
+  struct record_t final
+  {
+    ::std::uint32_t controls;
+    ::std::uint32_t value;
+    ::std::uint32_t i_binary;
+    ::std::uint32_t i_number;
+  };
+
+  //--reports one pass
+  void report(char const *const                     pass,
+              ::std::uint64_t const                 cycles,
+              ::std::chrono::duration<double> const elapsed,
+              ::std::uint64_t const                 checksum)
+  {
+    double const bytes{static_cast<double>(cycles) * static_cast<double>(sizeof(record_t))};
+    ::std::cout << pass
+                << " cycles: " << cycles
+                << " seconds: " << elapsed.count()
+                << " GB/s: " << ((bytes / elapsed.count()) / 1.0e9)
+                << " checksum: " << checksum
+                << ::std::endl;
+  }
+
+  //--records the given number of cycles; returns the checksum
+  ::std::uint64_t record(::std::string const  &path,
+                         ::std::uint64_t const cycles)
+  {
+    ::std::uint64_t checksum{0};
+    auto const start{::std::chrono::steady_clock::now()};
+    {
+      ::stimulus::writer_t<record_t> writer{path};
+      for  (auto const ix: ::std::ranges::views::iota(::std::uint64_t{0}, cycles))
+      {
+        auto const word{static_cast<::std::uint32_t>(ix)};
+        record_t const record{(word bitand 0x1Fu), compl word, word, (word >> 2)};
+        writer.put(record);
+        checksum = (checksum + record.controls + record.value);
+      }
+      writer.close();
+    }
+    ::std::chrono::duration<double> const elapsed{::std::chrono::steady_clock::now() - start};
+    report("record", cycles, elapsed, checksum);
+    return  checksum;
+  }
+
+  //--reads every record in place; returns the checksum
+  ::std::uint64_t play(char const *const    pass,
+                       ::std::string const &path)
+  {
+    ::std::uint64_t checksum{0};
+    auto const start{::std::chrono::steady_clock::now()};
+    ::stimulus::image_t<record_t> const image{path};
+    for  (auto const &record: image)
+      checksum = (checksum + record.controls + record.value);
+    ::std::chrono::duration<double> const elapsed{::std::chrono::steady_clock::now() - start};
+    report(pass, image.records(), elapsed, checksum);
+    return  checksum;
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int sc_main(int const    argc,
+            char **const argv)
+{
+  ::std::uint64_t const cycles{(argc > 1) ? ::std::stoull(argv[1])
+                                          : (64 * 1024 * 1024)};
+  ::std::string const path{(argc > 2) ? argv[2] : "/tmp/bench-stimulus.bin"};
+
+  auto const recorded{record(path, cycles)};
+  bool const is_match
+  {
+    (play("read", path) == recorded) and
+    (play("reread", path) == recorded)
+  };
+
+  //--end of compilation unit with explicit return
+  return  is_match ? 0 : 2;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -21,6 +21,7 @@
 //
 //  NOTES:
 //  2023-06-20: Moore and Peimann: first cut.
+//  2026-10-16: added signal_in_if and delta_count().
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -91,6 +92,9 @@
     template <typename T>
     using signal = ::sc_core::sc_signal<T>;
 
+    template <typename T>
+    using signal_in_if = ::sc_core::sc_signal_in_if<T>;
+
     using time = ::sc_core::sc_time;
 
     using trace_file = ::sc_core::sc_trace_file;
@@ -122,6 +126,11 @@
                                            line);
     }
 
+    inline auto delta_count()
+    {
+      return  ::sc_core::sc_delta_count();
+    }
+
     inline void start()
     {
       ::sc_core::sc_start();
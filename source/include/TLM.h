@@ -0,0 +1,112 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  TLM.h
+//  - wrapper for the SystemC TLM-2.0 library; as SC.h is for SystemC.
+//  - restricts the TLM-2.0 items used to the loosely-timed blocking
+//    transport: the generic payload, the simple sockets, and the
+//    quantum keeper.
+//
+//  NOTES:
+//  2026-10-16: created.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if not defined(__TLM_H__)
+# define __TLM_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+  // <none>
+
+  //--required library includes
+# if  defined(__GNUC__)
+#   pragma GCC diagnostic push
+
+#   pragma GCC diagnostic ignored "-Warith-conversion"
+#   pragma GCC diagnostic ignored "-Wcast-align"
+#   pragma GCC diagnostic ignored "-Wcast-qual"
+#   pragma GCC diagnostic ignored "-Weffc++"
+#   pragma GCC diagnostic ignored "-Wfloat-equal"
+#   pragma GCC diagnostic ignored "-Wnon-virtual-dtor"
+#   pragma GCC diagnostic ignored "-Wredundant-decls"
+#   pragma GCC diagnostic ignored "-Wshadow"
+#   pragma GCC diagnostic ignored "-Wsign-conversion"
+#   pragma GCC diagnostic ignored "-Wswitch-enum"
+#   pragma GCC diagnostic ignored "-Wunused-parameter"
+#   pragma GCC diagnostic ignored "-Wuseless-cast"
+# endif
+
+# include <tlm>
+# include <tlm_utils/simple_initiator_socket.h>
+# include <tlm_utils/simple_target_socket.h>
+# include <tlm_utils/tlm_quantumkeeper.h>
+
+# if  defined(__GNUC__)
+#   pragma GCC diagnostic pop
+# endif
+
+  //--required project includes
+# include "SC.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace TLM
+  {
+    //--types (and classes) from TLM-2.0
+    using command = ::tlm::tlm_command;
+
+    using generic_payload = ::tlm::tlm_generic_payload;
+
+    template <typename MODULE>
+    using initiator_socket = ::tlm_utils::simple_initiator_socket<MODULE>;
+
+    using quantum_keeper = ::tlm_utils::tlm_quantumkeeper;
+
+    using response_status = ::tlm::tlm_response_status;
+
+    template <typename MODULE>
+    using target_socket = ::tlm_utils::simple_target_socket<MODULE>;
+
+    //--manifest constants from TLM-2.0; renamed to provide clarity START
+    auto constexpr write_command = ::tlm::TLM_WRITE_COMMAND;
+
+    auto constexpr ok_response            = ::tlm::TLM_OK_RESPONSE;
+    auto constexpr incomplete_response    = ::tlm::TLM_INCOMPLETE_RESPONSE;
+    auto constexpr command_error_response = ::tlm::TLM_COMMAND_ERROR_RESPONSE;
+    //--manifest constants from TLM-2.0; renamed to provide clarity END
+
+    //--functions and macro wrappers for TLM-2.0
+    //--NB: we strip off the leading "tlm_".
+    inline void set_global_quantum(SC::time const &quantum)
+    { // time an initiator may run ahead of the kernel before it syncs
+      quantum_keeper::set_global_quantum(quantum);
+    }
+  } // namespace TLM
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--end of invocation guard
+#endif // not defined(__TLM_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
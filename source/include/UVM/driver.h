@@ -20,6 +20,20 @@
 //
 //  NOTES:
 //  2024-08-17: Moore, Peimann: created.
+//  2026-10-16: added idle/hold time warp to the single_cycle_t driver.
+//  2026-10-16: added method-process mode to the single_cycle_t driver.
+//  2026-10-16: no debug strings when MODEL_NO_DEBUG_STRING is defined.
+//  2026-10-16: debug strings are interned labels; interned once each.
+//  2026-10-16: a cycle is one transport when VIF_BACKEND_TLM is defined.
+//  2026-10-16: single_cycle_t reports when it is quiescent; for checkpoints.
+//  2026-10-16: single_cycle_t takes items pulled from coroutine sequences,
+//              as well as from its port; see: drive_item(...).
+//  2026-10-16: single_cycle_t reads its port's items in place, through the
+//              handle it is given; see: sequence_item.h.
+//  2026-10-16: single_cycle_t records the stimuli it drives, and plays
+//              recorded stimuli back; see: stimulus.h.
+//  2026-10-16: single_cycle_t converts items to stimuli from any thread;
+//              a helper thread may make them ahead, see: stimuli(...).
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,18 +42,21 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <cstdint>
 
   //--required library includes
   // <none>
 
   //--required project includes
 # include "UVM_wrapper.h"
+# include "stimulus.h"
 
 # include "request.h"
 # include "sequence_item.h"
 # include "sequencer.h"
+# include "utility.h"
 # include "vif.h"
+# include "EXAMPLE/single_cycle_model.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--declaratons
@@ -160,6 +177,28 @@
       using value_fixed_t =
         ::request::EXAMPLE::single_cycle_t::value_fixed_t;
 
+      //--one driven cycle, as recorded; NB: 16 bytes, plain data
+      struct stimulus_t final
+      {
+        ::std::uint32_t controls;  // bits: 0 reset, 1 is_advance, 2 is_error,
+                                   //       3 is_flush, 4 is_valid
+        ::model::value_t    value;
+        ::model::i_binary_t i_binary;
+        ::model::i_number_t i_number;
+      };
+      using stimulus_image_t  = ::stimulus::image_t<stimulus_t>;
+      using stimulus_writer_t = ::stimulus::writer_t<stimulus_t>;
+
+      //--the stimuli of one cycle, as driven
+      using input_t = ::EXAMPLE::single_cycle_model_t::input_t;
+
+    private:    // forward declarations and type aliases
+      using state_t = ::EXAMPLE::single_cycle_model_t::state_t;
+
+      //--stimuli fetched ahead of the clock; method-process mode only
+      static ::std::size_t constexpr buffer_size{64};
+      using buffer_t = ::utility::ring_buffer_t<input_t, buffer_size>;
+
     public:     // UVM evil
       UVM_COMPONENT_UTILS(::driver::EXAMPLE::single_cycle_t);
 
@@ -169,12 +208,101 @@
       { /* noOp */ }
       single_cycle_t(::uvm::uvm_component_name name)
         : base_t(name)
+        , m_phase{nullptr}
+        , m_is_method{false}
+        , m_is_busy{false}
+        , m_buffer{}
+        , m_drained{"drained"}
+        , m_is_warp{false}
+        , m_is_stable{false}
+        , m_debt{0}
+        , m_input{}
+        , m_state{}
+        , m_recorder{nullptr}
       { /* noOp */ }
+      single_cycle_t(single_cycle_t const &) = delete;
+      single_cycle_t &operator=(single_cycle_t const &) = delete;
       virtual ~single_cycle_t() override
       { /* noOp */ }
 
     public:     // accessors
+      bool is_quiescent() const
+      { // every stimulus taken is clocked; none owed, none in flight
+        return  ((m_debt == 0) and not m_is_busy);
+      }
+
     public:     // methods
+      void drive_begin()
+      { // before items are pulled: wait out stimuli from the port.
+        // NB: the port's items are clocked, or owed, by the driver's own
+        //     process; they are settled before any pulled item is driven.
+# if  not defined(VIF_BACKEND_TLM)
+        while  (not is_quiescent())
+          wait(vif().clock_posedge());
+# endif
+      }
+
+      void drive_item(sequence_item_t const &item)
+      { // drive an item pulled from a coroutine sequence, in the caller's
+        // thread; as if taken from the port.
+        // NB: see: ::sequence::coroutine_t
+        drive_input(item_dispatch(item));
+      }
+
+      void drive_input(input_t const &input)
+      { // drive the given stimuli, as the mode does
+        if  (m_is_method)
+          buffer(input);
+        else
+          drive(input);
+      }
+
+      void drive_end()
+      { // after the last item is pulled: pay the cycles owed.
+        // NB: method-process mode, the buffer drains as the clock runs.
+        if  (not m_is_method)
+          settle_debt();
+      }
+
+      void play(stimulus_image_t const &image)
+      { // drive the recorded stimuli, one record per cycle, in the
+        // caller's thread; as if pulled.
+        // NB: read in place; the records stream through the mapping.
+        static ::model::debug_string_t const label{"PLAYBACK"};
+        drive_begin();
+        for  (auto const &stimulus: image)
+        {
+          input_t const input
+          {
+            ((stimulus.controls bitand 0x01u) != 0),
+            ((stimulus.controls bitand 0x02u) != 0),
+            ((stimulus.controls bitand 0x08u) != 0),
+            ((stimulus.controls bitand 0x10u) != 0),
+            stimulus.value,
+            stimulus.i_binary,
+            stimulus.i_number,
+            ((stimulus.controls bitand 0x04u) != 0),
+            label,
+          };
+          drive_input(input);
+        }
+        drive_end();
+      }
+
+      static input_t stimuli(sequence_item_t const &item)
+      { // the stimuli to drive for the given item.
+        // NB: from any thread; touches nothing shared, save the labels,
+        //     which are interned before the kernel runs, see: g_label_*.
+        return  item_dispatch(item);
+      }
+
+      void record_to(stimulus_writer_t *const recorder)
+      { // record every cycle's stimuli, as driven; nullptr: stop.
+        // NB: a cycle per item, or per record played; the cycles a driver
+        //     idles between sequences, waiting on its port, are not.
+        m_recorder = recorder;
+      }
+
     protected:  // accessors
     protected:  // methods
       void build_phase(uvm::uvm_phase &phase) override
@@ -189,10 +317,36 @@
       { // spawnn necessary tasks.
         //--parent class behaviour as a pre-method
         base_t::run_phase(phase);
+        m_phase = &phase;
+# if  defined(VIF_BACKEND_TLM)
+        m_is_method = false;  // NB: loosely timed; there are no clock edges
+# else
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_method_process", m_is_method);
+# endif
+        //--time warp, when asked and the clock allows
+        //--NB: thread-process mode only
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_time_warp", m_is_warp);
+        m_is_warp = (m_is_warp and vif().can_warp() and not m_is_method);
         //--do the spawning
-        SC_FORK
-          sc_spawn(sc_bind(&single_cycle_t::do_sequence_items, this)),
-        SC_JOIN
+        if  (m_is_method)
+        { // stackless: one method activation per clock edge
+          ::sc_core::sc_spawn_options options{};
+          options.spawn_method();
+          options.set_sensitivity(&vif().clock_posedge());
+          options.dont_initialize();
+          sc_spawn(sc_bind(&single_cycle_t::do_clock_edge, this),
+                   "clock_edge",
+                   &options);
+          SC_FORK
+            sc_spawn(sc_bind(&single_cycle_t::do_fetch_items, this)),
+          SC_JOIN
+        }
+        else
+        {
+          SC_FORK
+            sc_spawn(sc_bind(&single_cycle_t::do_sequence_items, this)),
+          SC_JOIN
+        }
         //--end of compilation unit with implicit return
       }
 
@@ -201,88 +355,230 @@
     private:    // methods
       void do_wait_for_clock()
       { // wait for the next cycle
+# if  defined(VIF_BACKEND_TLM)
+        vif().transport();  // NB: waits only when the quantum is used up
+# else
         wait(vif().clock_posedge());
+# endif
       }
 
       void do_sequence_items()
       { // work off all sequence items
+        // NB: whilst in debt, do not block; settle once items run dry.
+        // NB: an item is a handle, lent until item_done(); see: referent().
+        sequence_item_t item;
+
+        while  (true)
+        {
+          if  (m_debt == 0)
+            seq_item_port.get_next_item(item);  // UVM SystemC
+          else if  (not seq_item_port.try_next_item(item))
+          {
+            settle_debt();
+            continue;
+          }
+          drive(item_dispatch(item.referent()));
+          seq_item_port.item_done();
+          item.release();  // NB: the lent item is the sequence's again
+        }
+      }
+
+      void record(input_t const &input)
+      { // the given stimuli, when recording; see: record_to(...)
+        if  (m_recorder == nullptr)
+          return;
+        m_recorder->put(
+          {
+            ((input.reset      ? 0x01u : 0u) bitor
+             (input.is_advance ? 0x02u : 0u) bitor
+             (input.is_error   ? 0x04u : 0u) bitor
+             (input.is_flush   ? 0x08u : 0u) bitor
+             (input.is_valid   ? 0x10u : 0u)),
+            input.value,
+            input.i_binary,
+            input.i_number,
+          });
+      }
+
+      void drive(input_t const &input)
+      { // drive the given stimuli for one cycle.
+        // NB: when the DUT/MUT state is stable under these very stimuli,
+        //     the cycle is owed rather than clocked; see: settle_debt().
+        record(input);
+        if  (m_is_warp and m_is_stable and (input == m_input))
+        {
+          if  (m_debt == 0)
+            m_phase->raise_objection(this);
+          m_debt = (m_debt + 1);
+          return;
+        }
+
+        settle_debt();
+
+        bool const is_same_input{input == m_input};
+        set_inputs(input);
+        do_wait_for_clock();
+
+        //--the same stimuli over two cycles that leave the sampled state
+        //--unchanged: the state is a fixed point of those stimuli.
+        auto const state{sample_state()};
+        m_is_stable = (is_same_input and (state == m_state));
+        m_state = state;
+      }
+
+      void settle_debt()
+      { // pay owed cycles: elide all but the last, and wait for that.
+        // NB: the monitor synthesizes transactions for elided cycles.
+        if  (m_debt == 0)
+          return;
+        vif().warp(m_debt - 1);
+        do_wait_for_clock();
+        m_debt = 0;
+        m_phase->drop_objection(this);
+      }
+
+      void set_inputs(input_t const &input)
+      { // write the given stimuli to the vif
+        vif().set_control_inputs(input.reset,
+                                 input.is_advance,
+                                 input.is_flush,
+                                 input.is_valid);
+        vif().set_data_inputs(input.value);
+        vif().set_debug_inputs(input.i_binary,
+                               input.i_number,
+                               input.is_error,
+                               input.string);
+        m_input = input;
+      }
+
+      void do_fetch_items()
+      { // method-process mode: fetch items ahead of the clock.
+        // NB: items complete when buffered, not when clocked; an objection
+        //     is held whilst buffered stimuli remain to be clocked.
+        // NB: sleeps whilst the buffer is full; do_clock_edge() wakes this
+        //     thread once the buffer is half drained.
         sequence_item_t item;
 
         while  (true)
         {
           seq_item_port.get_next_item(item);  // UVM SystemC
-          item_dispatch(item);
+          buffer(item_dispatch(item.referent()));
           seq_item_port.item_done();
+          item.release();  // NB: the lent item is the sequence's again
         }
       }
 
-      void item_dispatch(sequence_item_t const &item)
-      { // dispatch the given sequence item to the intended worker.
+      void buffer(input_t const &input)
+      { // method-process mode: buffer the given stimuli; drive them now,
+        // when idle, as the thread-process mode would.
+        record(input);
+        if  (m_buffer.is_full())
+          wait(m_drained);
+
+        m_buffer.put(input);
+        if  (not m_is_busy)
+        {
+          m_phase->raise_objection(this);
+          drive_next();
+        }
+      }
+
+      void do_clock_edge()
+      { // method-process mode: the stimuli in flight are clocked.
+        // NB: one activation per clock edge; never waits.
+        if  (not m_is_busy)
+          return;  // idle; nothing was in flight
+
+        m_is_busy = false;
+        if  (not m_buffer.is_empty())
+          drive_next();
+        else
+          m_phase->drop_objection(this);
+
+        if  (m_buffer.size() == (buffer_size / 2))
+          m_drained.notify();
+      }
+
+      void drive_next()
+      { // drive the next buffered stimuli; clocked at the next edge.
+        set_inputs(m_buffer.get());
+        m_is_busy = true;
+      }
+
+      state_t sample_state()
+      { // sample state that is currently output, excluding debug.string
+        state_t state{};
+        state.is_advance = vif().out.debug.is_advance.read();
+        state.is_error   = vif().out.ctl.is_error.read();
+        state.is_stall   = vif().out.ctl.is_stall.read();
+        state.is_valid   = vif().out.ctl.is_valid.read();
+        state.value      = vif().out.data.value.read();
+        state.i_binary   = vif().out.debug.i_binary.read();
+        state.i_number   = vif().out.debug.i_number.read();
+        return  state;
+      }
+
+      static input_t item_dispatch(sequence_item_t const &item)
+      { // dispatch the given sequence item to the intended worker;
+        // returns the stimuli to drive for the item.
         if  (item.holds<error_t>())
-          item_process(item.get_request<error_t>());
+          return  item_process(item.get_request<error_t>());
         else if  (item.holds<flush_t>())
-          item_process(item.get_request<flush_t>());
+          return  item_process(item.get_request<flush_t>());
         else if  (item.holds<hold_t>())
-          item_process(item.get_request<hold_t>());
+          return  item_process(item.get_request<hold_t>());
         else if  (item.holds<reset_t>())
-          item_process(item.get_request<reset_t>());
+          return  item_process(item.get_request<reset_t>());
         else if  (item.holds<random_weighted_t>())
-          item_process(item.get_request<random_weighted_t>());
+          return  item_process(item.get_request<random_weighted_t>());
         else if (item.holds<value_fixed_t>())
-          item_process(item.get_request<value_fixed_t>());
-        else
-          uvm_report_fatal(
-            "DRIVER",
-            "cannot dispatch based on item contained thing.");
+          return  item_process(item.get_request<value_fixed_t>());
+
+        ::uvm::uvm_report_fatal(
+          "DRIVER",
+          "cannot dispatch based on item contained thing.");
+        return  {};
       }
 
-      void item_process(error_t const &)
+      static input_t item_process(error_t const &)
       { // process a error request
         // fill in vif 
         auto i_binary = 0xE1000000;
         auto i_number = 0xE8000000;
-        vif().set_control_inputs(1, 1, 0, 1); //reset, is_advance, is_flush, is_valid 
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, true, "ERROR");
-        do_wait_for_clock();
+        return  input_t{1, 1, 0, 1, //reset, is_advance, is_flush, is_valid
+                        compl i_binary, i_binary, i_number, true, g_label_error};
       } // process a error request
 
-      void item_process(flush_t const &)
+      static input_t item_process(flush_t const &)
       { // process a flush request
 
         // fill in vif 
         auto i_binary = 0xE2000000;
         auto i_number = 0xEA000000;
-        vif().set_control_inputs(1, 1, 1, 1); //reset, is_advance, is_flush, is_valid 
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, false, "FLUSH");
-        do_wait_for_clock();
+        return  input_t{1, 1, 1, 1, //reset, is_advance, is_flush, is_valid
+                        compl i_binary, i_binary, i_number, false, g_label_flush};
       } // process a flush request
 
-      void item_process(hold_t const &)
+      static input_t item_process(hold_t const &)
       { // process a hold request
         // fill in vif 
         auto i_binary = 0xE4000000;
         auto i_number = 0xEC000000;
-        vif().set_control_inputs(1, 1, 0, 0); //reset, is_advance, is_flush, is_valid 
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, false, "HOLD");
-        do_wait_for_clock();
+        return  input_t{1, 1, 0, 0, //reset, is_advance, is_flush, is_valid
+                        compl i_binary, i_binary, i_number, false, g_label_hold};
       }
 
-      void item_process(reset_t const &)
+      static input_t item_process(reset_t const &)
       { // process a reset request
         // NB: item has a reset_t request
         // fill in vif 
         auto i_binary = 0xD1000000;
         auto i_number = 0xD8000000;
-        vif().set_control_inputs(0, 0, 0, 0);
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, false, "RESET");
-        do_wait_for_clock();
+        return  input_t{0, 0, 0, 0, //reset, is_advance, is_flush, is_valid
+                        compl i_binary, i_binary, i_number, false, g_label_reset};
       }
 
-      void item_process(random_weighted_t const &request)
+      static input_t item_process(random_weighted_t const &request)
       { // process a randomly weighted request
         // NB: the request is randomised by the sequence
         auto is_advance = request.is_advance();
@@ -292,13 +588,12 @@
         auto reset = request.reset();
         auto i_binary = request.i_binary();
         auto i_number = request.i_number();
-        vif().set_control_inputs(reset, is_advance, is_flush, is_valid);
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, is_error, "RANDOM_WEIGHTED");
-        do_wait_for_clock();
+        return  input_t{reset, is_advance, is_flush, is_valid,
+                        compl i_binary, i_binary, i_number, is_error,
+                        g_label_random_weighted};
       }
 
-      void item_process(value_fixed_t const &request)
+      static input_t item_process(value_fixed_t const &request)
       { // process a request that feed in
         // send the given request to the DUT/MUT.
         auto is_advance = request.is_advance();
@@ -308,19 +603,53 @@
         auto reset = request.reset();
         auto i_binary = request.i_binary();
         auto i_number = request.i_number();
+# if  defined(MODEL_NO_DEBUG_STRING)
+        ::model::debug_string_t const prefix{};  // NB: not even copied
+# else
         auto prefix = request.prefix();
-        if  (false and not prefix.empty())
-          uvm_report_info("DEBUG", ("PREFIX[" + prefix + "]"));
-        vif().set_control_inputs(reset, is_advance, is_flush, is_valid);
-        vif().set_data_inputs(compl i_binary);
-        vif().set_debug_inputs(i_binary, i_number, is_error, prefix);
-        do_wait_for_clock();
+        if  (false and (prefix != ::label::label_t{}))
+          ::uvm::uvm_report_info("DEBUG", ("PREFIX[" + prefix.text() + "]"));
+# endif
+        return  input_t{reset, is_advance, is_flush, is_valid,
+                        compl i_binary, i_binary, i_number, is_error,
+                        prefix};
       }
 
     private:    // type and class definitions
+    private:    // globals
+      //--the requests' debug labels
+      //--NB: interned at static initialisation, before any helper thread
+      //--    can convert; see: stimuli(...)
+      static ::model::debug_string_t const g_label_error;
+      static ::model::debug_string_t const g_label_flush;
+      static ::model::debug_string_t const g_label_hold;
+      static ::model::debug_string_t const g_label_reset;
+      static ::model::debug_string_t const g_label_random_weighted;
+
     private:    // attributes
+      ::uvm::uvm_phase *m_phase;      // the run phase; for objections
+      bool              m_is_method;  // true: method-process mode
+      bool              m_is_busy;    // true: stimuli in flight
+      buffer_t          m_buffer;     // stimuli yet to be driven
+      ::sc_core::sc_event m_drained;  // buffer is half drained
+      bool              m_is_warp;    // true: time warp is enabled
+      bool              m_is_stable;  // true: state is a fixed point of m_input
+      ::std::uint64_t   m_debt;       // cycles owed; see: settle_debt()
+      input_t           m_input;      // stimuli last driven
+      state_t           m_state;      // state last sampled
+      stimulus_writer_t *m_recorder;  // nullptr: not recording
   }; // class ::driver::EXAMPLE::single_cycle_t
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--variables ::driver::EXAMPLE::single_cycle_t::g_label_*
+  //--NB: see: stimuli(...)
+
+  ::model::debug_string_t const driver::EXAMPLE::single_cycle_t::g_label_error{"ERROR"};
+  ::model::debug_string_t const driver::EXAMPLE::single_cycle_t::g_label_flush{"FLUSH"};
+  ::model::debug_string_t const driver::EXAMPLE::single_cycle_t::g_label_hold{"HOLD"};
+  ::model::debug_string_t const driver::EXAMPLE::single_cycle_t::g_label_reset{"RESET"};
+  ::model::debug_string_t const driver::EXAMPLE::single_cycle_t::g_label_random_weighted{"RANDOM_WEIGHTED"};
+
   //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
 //--end of invocation guard
@@ -23,6 +23,11 @@
 //
 //  NOTES:
 //  2024-08-19: Moore, Peimann: created.
+//  2026-10-16: replicated instances; one vif, agent, and monitor per
+//              instance, see: config_db keys "instances" and "vif_<n>".
+//  2026-10-16: each instance's vif is public, see: vif(...).
+//  2026-10-16: the instances share the one master seed, "random_seed";
+//              their streams differ by name, see: sequencer.h.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -31,7 +36,11 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <ranges>
+# include <vector>
 
   //--required library includes
   // <none>
@@ -41,6 +50,7 @@
 
 # include "agent.h"
 # include "monitor.h"
+# include "utility.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--forward declaratons
@@ -59,7 +69,9 @@
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   // class ::environment::base_t
   // UVM environment base class for all DUTs/MUTs
-  // NB: provides lookup for VIF, assuming it is required.
+  // NB: provides lookup for VIFs, assuming they are required.
+  // NB: one VIF per replicated instance; the config_db key "instances"
+  //     gives the count (default one), and "vif_<n>" the n-th VIF.
 
   template<class VIRTUAL_INTERFACE_T>
   class environment::base_t
@@ -72,43 +84,56 @@
     public:     // c'tors and d'tor
       base_t(::uvm::uvm_component_name name)
         : uvm_env{name}
-        , m_vif{nullptr}
+        , m_vifs{}
       { /* noOp */ }
 
       virtual ~base_t()
       {
-        m_vif = nullptr;
+        m_vifs.clear();
       }
 
       base_t(base_t const &) = delete;
       base_t &operator=(base_t const &) = delete;
 
+    public:     // accessors
+      ::std::size_t instances() const
+      { return  m_vifs.size(); }
+      vif_t &vif(::std::size_t const index) const
+      { return  *m_vifs.at(index); }
+
     public:     // methods
       void build_phase(uvm::uvm_phase& phase) override
       {
         uvm_env::build_phase(phase);
 
-        if (not uvm::uvm_config_db<vif_ptr>::get(this, "", "vif", m_vif))
-          uvm_report_fatal(
-            "NO_VIF",
-            "Virtual interface not found in config_db.");
+        unsigned instances{1};
+        uvm::uvm_config_db<unsigned>::get(this, "", "instances", instances);
+        m_vifs.assign(instances, nullptr);
+
+        using ::utility::format::indexed;
+        for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+          if (not uvm::uvm_config_db<vif_ptr>::get(this, "", indexed("vif", ix), m_vifs[ix]))
+            uvm_report_fatal(
+              "NO_VIF",
+              ("Virtual interface " + indexed("vif", ix) + " not found in config_db."));
       }
 
     protected:  // methods
-      vif_t &vif() const
-      { return  *m_vif; }
-
     protected:  // declarations
     protected:  // attributes
     private:    // methods
     private:    // declarations
     private:    // attributes
-      vif_ptr  m_vif;
+      ::std::vector<vif_ptr> m_vifs;  // one per instance
   };
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   // class ::environment::EXAMPLE::single_cycle_t
   // test environment for module ::EXAMPLE::single_cycle_t
+  // NB: one agent and one monitor per replicated instance; each sees its
+  //     own VIF, as "vif".
+  // NB: every sequencer sees the one master seed, "random_seed"; each
+  //     instance's agent has its own name, thus its own random streams.
 
   class environment::EXAMPLE::single_cycle_t 
     : public ::environment::base_t<::vif::EXAMPLE::single_cycle_t>
@@ -125,33 +150,44 @@
     public:  // c'tors and d'tor
       single_cycle_t(::uvm::uvm_component_name name)
         : base_t{name}
-        , m_agent{}
-        , m_monitor{}
+        , m_agents{}
+        , m_monitors{}
       { /* noOp */ }
 
       virtual ~single_cycle_t() override
       { /* noOp */ }
 
     public:  // accessors
-      agent_t &agent()
-      { return  *m_agent; }
-      monitor_t &monitor()
-      { return  *m_monitor; }
+      agent_t &agent(::std::size_t const index)
+      { return  *m_agents.at(index); }
+      monitor_t &monitor(::std::size_t const index)
+      { return  *m_monitors.at(index); }
 
     public:  // methods
       void build_phase(uvm::uvm_phase &phase) override
       {
         base_t::build_phase(phase);
 
-        m_monitor.reset(
-          monitor_t::type_id::create("m_monitor", this));
-        m_agent.reset(
-          agent_t::type_id::create("m_agent", this));
+        using ::utility::format::indexed;
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, instances()))
+        {
+          auto const agent_name  {indexed("m_agent", ix)};
+          auto const monitor_name{indexed("m_monitor", ix)};
+
+          //--the instance's VIF, under the plain key
+          uvm::uvm_config_db<vif_ptr>::set(this, (agent_name + ".*"), "vif", &vif(ix));
+          uvm::uvm_config_db<vif_ptr>::set(this, monitor_name, "vif", &vif(ix));
+
+          m_monitors.emplace_back(
+            monitor_t::type_id::create(monitor_name, this));
+          m_agents.emplace_back(
+            agent_t::type_id::create(agent_name, this));
+        }
       }
 
     private:  // attributes
-      agent_ptr    m_agent;
-      monitor_ptr  m_monitor;
+      ::std::vector<agent_ptr>    m_agents;    // one per instance
+      ::std::vector<monitor_ptr>  m_monitors;  // one per instance
   };
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
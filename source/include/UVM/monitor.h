@@ -20,6 +20,12 @@
 //
 //  NOTES:
 //  2024-08-02: Moore, Peimann: created.
+//  2026-10-16: single_cycle_t synthesizes transactions for warped cycles.
+//  2026-10-16: added method-process mode to the single_cycle_t monitor.
+//  2026-10-16: single_cycle_t observes transported payloads when
+//              VIF_BACKEND_TLM is defined.
+//  2026-10-16: single_cycle_t observes its bank lane's transactions when
+//              VIF_BACKEND_BANK is defined.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,7 +34,8 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <cstdint>
+# include <ranges>
 
   //--required library includes
   // <none>
@@ -132,6 +139,8 @@
   { // input/output monitor
     // NB: collects DUT/MUT inputs and outputs every cycle.
     // NB: drops first cycle sample, as there is simply no valid signal input.
+    // NB: cycles elided by a time warp had stable state and stimuli, thus
+    //     each repeats the transaction completed at the following edge.
     public:     // forward declarations, &c.
     public:     // UVM evil
       UVM_COMPONENT_UTILS(::monitor::EXAMPLE::single_cycle_t);
@@ -139,6 +148,9 @@
     public:     // c'tors and d'tor
       single_cycle_t(uvm::uvm_component_name name)
         : base_t(name)
+        , m_signals{}
+        , m_state{state_t::start}
+        , m_transaction{}
       { /* noOp */ }
 
       virtual ~single_cycle_t() override
@@ -151,27 +163,128 @@
       void run_phase(uvm::uvm_phase &phase) override
       {
         base_t::run_phase(phase);
-        SC_FORK
-          sc_spawn(sc_bind(&single_cycle_t::collect_transactions, this)),
-        SC_JOIN
+
+# if  defined(VIF_BACKEND_TLM) or defined(VIF_BACKEND_BANK)
+        //--loosely timed: each transported payload is a transaction
+        //--bit-sliced bank: each lane's clocked cycle is a transaction
+        vif().observe([this](transaction_t::value_t const &signals)
+                      { transmit(signals); });
+# else
+        bool is_method{false};
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_method_process", is_method);
+        if  (is_method)
+        { // stackless: the FSM resumes once per clock edge
+          ::sc_core::sc_spawn_options options{};
+          options.spawn_method();
+          sc_spawn(sc_bind(&single_cycle_t::collect_transaction, this),
+                   "collect_transaction",
+                   &options);
+        }
+        else
+        {
+          SC_FORK
+            sc_spawn(sc_bind(&single_cycle_t::collect_transactions, this)),
+          SC_JOIN
+        }
+# endif
       }
 
+    private:    // type and class definitions
+      enum class state_t
+      {
+        complete,     // the monitor can die now
+        start,        // start-up and one-time initialisation
+        tr_initialise,// initialise sampled signals
+        sample_begin, // sample transaction beginning (state and stimuli)
+        wait,         // wait for a valid output to capture
+        tr_begin,     // UVM mechanics
+        sample_end,   // sample transaction completion state
+        tr_end,       // UVM mechanics
+        transmit,     // transmit the transaction to all listeners
+      };
+
     private:    // methods
-      void collect_transactions()
-      { // collect inputs and outputs for every cycle the DUT/MUT executes.
-        enum class state_t
+      void transmit(transaction_t::value_t const &signals)
+      { // loosely-timed and bank modes: transmit one complete cycle.
+        // NB: called from within the driver's transport, or the bank's
+        //     clock edge; never waits.
+        m_transaction.invalidate();
+        begin_tr(m_transaction);
+        m_transaction.value(signals);
+        end_tr(m_transaction);
+        output().write(m_transaction);
+      }
+
+      void collect_transaction()
+      { // method-process mode: the collect_transactions() FSM, resumed
+        // once per clock edge.
+        // NB: each wait becomes a next_trigger(...) and a return; the
+        //     FSM state persists in m_state between activations.
+        while  (true)
         {
-          complete,     // the monitor can die now
-          start,        // start-up and one-time initialisation
-          tr_initialise,// initialise sampled signals
-          sample_begin, // sample transaction beginning (state and stimuli)
-          wait,         // wait for a valid output to capture
-          tr_begin,     // UVM mechanics
-          sample_end,   // sample transaction completion state
-          tr_end,       // UVM mechanics
-          transmit,     // transmit the transaction to all listeners
-        };
+          switch  (m_state)
+          {
+            case  state_t::complete:  // uh oh!  should never get here
+              UVM_FATAL("STATE_BAD", "state_t::complete reached we stopped looping for transactions.");
+              return;
+
+            case  state_t::start:  // one-time start-up initialisation
+              m_state = state_t::tr_initialise;
+              next_trigger(vif().clock_posedge());
+              return;
+
+            case  state_t::tr_initialise:  // transaction start-up initialisilation
+              m_transaction.reset();
+              m_signals.state_1 = sample_state();
+              m_state = state_t::sample_begin;
+              break;
+
+            case  state_t::sample_begin:  // sample input signals
+              m_transaction.invalidate();            // we have incomplete data
+              m_signals.state_0 = m_signals.state_1; // capture start state and input
+              m_signals.stimuli = sample_stimuli();
+              m_state = state_t::wait;
+              break;
 
+            case  state_t::wait:  // wait for output to capture
+              m_state = state_t::tr_begin;
+              next_trigger(vif().clock_posedge());
+              return;
+
+            case  state_t::tr_begin:  // UVM mechanics - start the transaction
+              begin_tr(m_transaction);
+              m_state = state_t::sample_end;
+              break;
+
+            case  state_t::sample_end:  // sample output signals
+              m_signals.state_1 = sample_state();
+              m_transaction.value(m_signals);
+              m_state = state_t::tr_end;
+              break;
+
+            case  state_t::tr_end:  // UVM mechanics - end the transaction
+              end_tr(m_transaction);
+              m_state = state_t::transmit;
+              break;
+
+            case  state_t::transmit:  // once, and once per elided cycle
+              for  (auto const ix [[maybe_unused]]:
+                      ::std::ranges::views::iota(::std::uint64_t{0},
+                                                 (1 + vif().warped())))
+                output().write(m_transaction);
+              m_state = state_t::sample_begin;
+              break;
+
+            default:
+              UVM_FATAL("STATE_INVALID",
+                        "Whisky Tango Foxtrot - how did we get here?");
+              return;
+          }
+        }
+      }
+
+      void collect_transactions()
+      { // collect inputs and outputs for every cycle the DUT/MUT executes.
         transaction_t::value_t signals;
         state_t                state{state_t::start};
         transaction_t          transaction;
@@ -223,8 +336,11 @@
               state = state_t::transmit;
               [[fallthrough]];
 
-            case  state_t::transmit:
-              output().write(transaction);
+            case  state_t::transmit:  // once, and once per elided cycle
+              for  (auto const ix [[maybe_unused]]:
+                      ::std::ranges::views::iota(::std::uint64_t{0},
+                                                 (1 + vif().warped())))
+                output().write(transaction);
               state = state_t::sample_begin;
               break;
 
@@ -280,8 +396,11 @@
         };
       } // END sample_stimuli 
 
-    private:    // type and class definitions
     private:    // attributes
+                // NB: method-process and loosely-timed modes only
+      transaction_t::value_t m_signals;      // sampled signals
+      state_t                m_state;        // FSM state between edges
+      transaction_t          m_transaction;  // transaction in progress
   }; // class ::monitor::data_output_t
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -21,6 +21,21 @@
 //
 //  NOTES:
 //  2024-07-18: Moore, Peimann: created.
+//  2026-10-16: the value_fixed_t prefix is an interned label.
+//  2026-10-16: requests draw from a selectable random stream; one stream
+//              per replicated instance, see: random_stream(...).
+//  2026-10-16: the common generator can be saved and restored, see:
+//              random_engine(...).
+//  2026-10-16: the random engine is a build option; REQUEST_RANDOM_XOSHIRO
+//              selects xoshiro256**, generated a block at a time, see:
+//              prng.h.
+//  2026-10-16: random_weighted_t takes its control weights from
+//              configuration, compiled to an alias table; one draw for the
+//              control inputs, one for the debug values.  See: weights(...).
+//  2026-10-16: the selected random stream is per OS thread; a helper thread
+//              randomises from its own, see: ::sequence::producer_t.
+//  2026-10-16: REQUEST_RANDOM_XOSHIRO selects one xoshiro256** engine, not
+//              a block of them; it is the faster for the baseline ISA.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -29,7 +44,13 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
+# include <cstddef>
 # include <random>
+# include <ranges>
+# include <sstream>
+# include <stdexcept>
+# include <string>
+# include <vector>
 
   //--required library includes
   // <none>
@@ -37,7 +58,9 @@
   //--required project includes
 # include "UVM_wrapper.h"
 
+# include "distribution.h"
 # include "model.h"
+# include "prng.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--declaratons
@@ -73,6 +96,17 @@
 
   class request::base_t
   { // base class for all bare requests.
+    public:     // forward declarations and type aliases
+      //--the engine of the common generator, and of every stream
+      //--NB: the default is ::std::mt19937_64; REQUEST_RANDOM_XOSHIRO
+      //--    selects xoshiro256**, faster in an optimised build.  Not
+      //--    block_t; see: prng.h.
+# if  defined(REQUEST_RANDOM_XOSHIRO)
+      using random_engine_t = ::prng::xoshiro256_t;
+# else
+      using random_engine_t = ::std::mt19937_64;
+# endif
+
     public:     // UVM evil
     public:     // c'tors and d'tor
       base_t()
@@ -82,6 +116,16 @@
       { /* noOp */ }
 
     public:     // accessors
+      static random_engine_t const &random_engine()
+      { // the common random number generator; NB: for checkpoints
+        return  g_random_number_generatior;
+      }
+
+      static void random_engine(random_engine_t const &engine)
+      { // restore the common random number generator; see: checkpoint.h
+        g_random_number_generatior = engine;
+      }
+
     public:     // methods
       virtual void randomise() = 0;
 
@@ -90,24 +134,43 @@
         g_random_number_generatior.seed(seed);
       }
 
+      static void random_stream(random_engine_t *const stream)
+      { // draw from the given stream until another is selected;
+        // NB: nullptr selects the common random number generator.
+        // NB: select immediately before randomise(); nothing between
+        //     may wait, thus no other process can select in between.
+        // NB: per OS thread; the common generator is the kernel's alone.
+        g_random_stream = ((stream != nullptr) ? stream
+                                               : &g_random_number_generatior);
+      }
+
     protected:  // methods
       static ::std::uint64_t random64u()
       {
         static_assert(
           (sizeof random64u() == sizeof g_random_number_generatior()),
           "Random number must return a 64 bit value.");
-        return  g_random_number_generatior();
+        return  (*g_random_stream)();
       }
 
     private:    // attributes and globals
-      static ::std::mt19937_64  g_random_number_generatior;
+      static random_engine_t    g_random_number_generatior;
+      static thread_local random_engine_t *g_random_stream;
   }; // class ::request::base_t
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--variable request::base_t::g_random_number_generatior
   //--NB: common random number generator for all request types
 
-  ::std::mt19937_64 request::base_t::g_random_number_generatior{};
+  request::base_t::random_engine_t request::base_t::g_random_number_generatior{};
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--variable request::base_t::g_random_stream
+  //--NB: the stream requests currently draw from, per OS thread; see:
+  //--    random_stream(...)
+
+  thread_local request::base_t::random_engine_t *request::base_t::g_random_stream{
+    &request::base_t::g_random_number_generatior};
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--class ::request::base_empty_t
@@ -210,6 +273,34 @@
   class request::EXAMPLE::single_cycle_t::random_weighted_t final
     : public ::request::base_t
   {
+    public:     // forward declarations and type aliases
+      //--one of the 32 combinations of the control inputs, per draw
+      using distribution_t = ::distribution::alias_t<32>;
+
+      //--the weights of the control inputs; see: weights(...)
+      //--NB: each field is the probability its input is asserted; reset is
+      //--    active low, thus its field is that of a reset.
+      //--NB: joint, when not empty, is the weight of each combination, and
+      //--    overrides the fields; in a combination, bit 0 is a reset, bit 1
+      //--    is_advance, bit 2 is_error, bit 3 is_flush, bit 4 is_valid.
+      struct weights_t final
+      {
+        double                reset     {1.0 / 256.0};
+        double                is_advance{3.0 / 4.0};
+        double                is_error  {1.0 / 1024.0};
+        double                is_flush  {1.0 / 64.0};
+        double                is_valid  {3.0 / 4.0};
+        ::std::vector<double> joint     {};
+
+        //--from "FIELD=P,..."; P as per ::distribution::probability(...),
+        //--  and joint as "joint=W0:W1:...:W31"
+        //--NB: unnamed fields keep their defaults; e.g. "is_error=1/64".
+        static weights_t parse(::std::string const &text);
+
+        //--the weight of each combination
+        distribution_t::weights_t combinations() const;
+      };
+
     public:     // UVM evil
     public:     // c'tors and d'tor
       random_weighted_t()
@@ -254,14 +345,29 @@
       {
         assert_alive();
 
-        auto bits{random64u()};
-        m_reset      = ((bits bitand 0x0000'0000'00FF) != 0);  // 1 in 256; NB: negative signal
-        m_is_advance = ((bits bitand 0x0000'0000'0300) != 0);  // 3 in 4
-        m_is_error   = ((bits bitand 0x0000'03FF'0000) == 0);  // 1 in 1024
-        m_is_flush   = ((bits bitand 0x003F'0000'0000) == 0);  // 1 in 64
-        m_is_valid   = ((bits bitand 0x0300'0000'0000) != 0);  // 3 in 4
-        m_i_binary   = (0xFFFFFFFF bitand random64u());
-        m_i_number   = (0xFFFFFFFF bitand random64u());
+        //--the control inputs; one combination, one draw
+        auto const bits{g_distribution(random64u())};
+        m_reset      = ((bits bitand 0x01) == 0);  // NB: negative signal
+        m_is_advance = ((bits bitand 0x02) != 0);
+        m_is_error   = ((bits bitand 0x04) != 0);
+        m_is_flush   = ((bits bitand 0x08) != 0);
+        m_is_valid   = ((bits bitand 0x10) != 0);
+
+        //--the debug values; one draw, a half each
+        auto const values{random64u()};
+        m_i_binary   = static_cast<::model::i_binary_t>(values);
+        m_i_number   = static_cast<::model::i_number_t>(values >> 32);
+      }
+
+      static void weights(weights_t const &weights)
+      { // compile the weights; every request randomises with them hence.
+        // NB: throws ::std::invalid_argument, as per ::distribution::alias_t.
+        g_distribution = distribution_t{weights.combinations()};
+      }
+
+      static distribution_t const &distribution()
+      { // the compiled weights; NB: for reports
+        return  g_distribution;
       }
 
     protected:  // methods
@@ -285,8 +391,99 @@
       ::model::is_valid_t    m_is_valid;
       ::model::i_binary_t    m_i_binary;
       ::model::i_number_t    m_i_number;
+
+    private:    // globals
+      static distribution_t  g_distribution;  // the compiled weights
   }; // class ::request::EXAMPLE::single_cycle_t::random_weighted_t
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--method ::request::EXAMPLE::single_cycle_t::random_weighted_t::weights_t::parse(text)
+
+  request::EXAMPLE::single_cycle_t::random_weighted_t::weights_t
+  request::EXAMPLE::single_cycle_t::random_weighted_t::weights_t::parse(
+    ::std::string const &text)
+  {
+    weights_t result{};
+
+    ::std::istringstream fields{text};
+    for  (::std::string field{}; ::std::getline(fields, field, ',');)
+    {
+      auto const equals{field.find('=')};
+      if  (equals == ::std::string::npos)
+        throw  ::std::invalid_argument("not FIELD=VALUE: \"" + field + "\"");
+      auto const name {field.substr(0, equals)};
+      auto const value{field.substr(equals + 1)};
+
+      if  (name == "reset")
+        result.reset = ::distribution::probability(value);
+      else if  (name == "is_advance")
+        result.is_advance = ::distribution::probability(value);
+      else if  (name == "is_error")
+        result.is_error = ::distribution::probability(value);
+      else if  (name == "is_flush")
+        result.is_flush = ::distribution::probability(value);
+      else if  (name == "is_valid")
+        result.is_valid = ::distribution::probability(value);
+      else if  (name == "joint")
+      { // one weight per combination; checked when compiled
+        result.joint.clear();
+        ::std::istringstream weights{value};
+        for  (::std::string weight{}; ::std::getline(weights, weight, ':');)
+        {
+          ::std::size_t used{0};
+          try
+          { result.joint.push_back(::std::stod(weight, &used)); }
+          catch (::std::logic_error const &)
+          { used = 0; }
+          if  ((used == 0) or (used != weight.size()))
+            throw  ::std::invalid_argument("not a weight: \"" + weight + "\"");
+        }
+        if  (result.joint.size() != distribution_t::weights_t{}.size())
+          throw  ::std::invalid_argument("joint has one weight per combination, 32.");
+      }
+      else
+        throw  ::std::invalid_argument("not a field: \"" + name + "\"");
+    }
+
+    return  result;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--method ::request::EXAMPLE::single_cycle_t::random_weighted_t::weights_t::combinations()
+  //--NB: the fields are independent; their product, unless joint is given.
+
+  request::EXAMPLE::single_cycle_t::random_weighted_t::distribution_t::weights_t
+  request::EXAMPLE::single_cycle_t::random_weighted_t::weights_t::combinations() const
+  {
+    distribution_t::weights_t result{};
+    if  ((not joint.empty()) and (joint.size() != result.size()))
+      throw  ::std::invalid_argument("joint has one weight per combination, 32.");
+
+    for  (auto const bits: ::std::ranges::views::iota(::std::size_t{0}, result.size()))
+    {
+      if  (not joint.empty())
+      {
+        result[bits] = joint[bits];
+        continue;
+      }
+
+      auto const p{[bits](::std::size_t const bit, double const asserted)
+      { return  ((bits bitand bit) != 0) ? asserted : (1.0 - asserted); }};
+      result[bits] = (p(0x01, reset) * p(0x02, is_advance) * p(0x04, is_error) *
+                      p(0x08, is_flush) * p(0x10, is_valid));
+    }
+    return  result;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--variable request::EXAMPLE::single_cycle_t::random_weighted_t::g_distribution
+  //--NB: the default weights; a reset 1 in 256, advance 3 in 4, error 1 in
+  //--    1024, flush 1 in 64, and valid 3 in 4.
+
+  request::EXAMPLE::single_cycle_t::random_weighted_t::distribution_t
+  request::EXAMPLE::single_cycle_t::random_weighted_t::g_distribution{
+    weights_t{}.combinations()};
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--class ::request::EXAMPLE::single_cycle_t::value_fixed_t
   //--a request with fixed values, not subject to random predation or
@@ -364,7 +561,7 @@
         return  *this;
       }
 
-      value_fixed_t &set_prefix(::std::string const &prefix)
+      value_fixed_t &set_prefix(::label::label_t const &prefix)
       {
         assert_alive();
         m_prefix = prefix;
@@ -396,7 +593,7 @@
       ::model::is_valid_t    m_is_valid;
       ::model::i_binary_t    m_i_binary;
       ::model::i_number_t    m_i_number;
-      ::std::string          m_prefix;
+      ::label::label_t       m_prefix;   // NB: interned once, when set
   }; // class ::request::EXAMPLE::single_cycle_t::value_fixed_t
 
   //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -20,6 +20,9 @@
 //
 //  NOTES:
 //  2024-08-02: Moore, Peimann: created.
+//  2026-10-16: data_values_t and control_bits_t publish their counts.
+//  2026-10-16: every EXAMPLE score board's counts can be restored, see:
+//              checkpoint.h.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -434,6 +437,11 @@
       { /* noOp */ }
 
     public:     // accessors
+      counter::pass_fail_count_t const &count() const
+      { return  m_count; }
+      void count(counter::pass_fail_count_t const &value)
+      { m_count = value; }
+
     public:     // methods
       virtual bool is_pass() const override
       { // verify that all pass criteria are met.
@@ -513,6 +521,11 @@
       { /* noOp */ }
 
     public:     // accessors
+      counter::pass_fail_count_t const &count() const
+      { return  m_count; }
+      void count(counter::pass_fail_count_t const &value)
+      { m_count = value; }
+
     public:     // methods
       virtual bool is_pass() const override
       { // All transaction should pass with no failures
@@ -610,6 +623,10 @@
       { /* noOp */ }
 
     public:     // accessors
+      counter::control_bit_pairs_t<N_INPUT_CONTROL_BITS> const &count() const
+      { return  m_count; }
+      void count(counter::control_bit_pairs_t<N_INPUT_CONTROL_BITS> const &value)
+      { m_count = value; }
     public:     // methods
       virtual bool is_pass() const override
       {
@@ -23,9 +23,38 @@
 //      -- reset_advance_with_out_valid_t;
 //      -- all_control_pairs_t;
 //      -- random_weighted_t;
+//      -- coverage_adaptive_t;
+//      -- coverage_holes_t;
+//  - and coroutine ports of some, which the driver pulls directly; see:
+//    coroutine_t.
+//      -- coroutine::random_loop_t;
+//      -- coroutine::random_weighted_t;
 //
 //  NOTES:
 //  2024-07-19: Moore, Peimann: created.
+//  2026-10-16: items randomise from their sequencer's random stream.
+//  2026-10-16: added de_bruijn_t; all_control_pairs_t sends one de Bruijn
+//              sequence per iteration, rather than every pair in turn.
+//  2026-10-16: each sequence randomises from its own stream, split from
+//              its sequencer's master seed by name; see: sequencer.h.
+//  2026-10-16: all_control_pairs_t labels its items with deferred labels;
+//              nothing is formatted per item, see: label.h.
+//  2026-10-16: added coroutine_t, and coroutine ports of random_loop_t
+//              and random_weighted_t; see: coroutine.h.
+//  2026-10-16: base_t lends its items to the driver by handle, where the
+//              item can be a handle; nothing is copied per item.
+//  2026-10-16: added producer_t; coroutine_t runs ahead on a helper thread,
+//              when asked, see: start_ahead(...).
+//  2026-10-16: added coverage_adaptive_t; weights that chase the control
+//              input pairs not yet covered.  base_t lends its random
+//              stream to derived classes, see: random_stream().
+//  2026-10-16: added coverage_holes_t; a directed walk of the control
+//              input pairs not yet covered, see: coverage.h.
+//  2026-10-16: producer_t's helper stops at the last item; the coroutine
+//              is finished, and its items destroyed, on the consuming
+//              thread.  The coroutine ports mark their last items.
+//  2026-10-16: base_t and coroutine_t deselect their random stream once
+//              each item is randomised; none is left selected.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -35,14 +64,27 @@
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
   //--NB: std::format is not supported in GNU 12.2 compiler
+# include <algorithm>
+# include <atomic>
+# include <concepts>
+# include <cstddef>
+# include <exception>
+# include <memory>
 # include <ranges>
 # include <sstream>
+# include <string>
+# include <thread>
+# include <utility>
+# include <vector>
 
   //--required library includes
   // <none>
 
   //--required project includes
 # include "UVM_wrapper.h"
+# include "coroutine.h"
+# include "coverage.h"
+# include "distribution.h"
 
 # include "sequence_item.h"
 # include "sequencer.h"
@@ -73,6 +115,25 @@
     //--    development of a driver.
     template<unsigned COUNT = 10>
     using repeat_empty_t = repeat_t<::sequence_item::empty_t, COUNT>;
+
+    //--a de Bruijn sequence of N_BITS-bit symbols; every ordered tuple of
+    //--N_TUPLE symbols occurs exactly once.
+    //--NB: a symbol generator, not a UVM sequence; sequences feed its
+    //--    symbols into requests, e.g. all_control_pairs_t.
+    template<unsigned N_BITS, unsigned N_TUPLE>
+    class de_bruijn_t;
+
+    //--base class for coroutine sequences; do_body() yields the items,
+    //--and a driver pulls them, with no start_item()/finish_item().
+    //--NB: cannot be directly instantiated.
+    //--NB: not a UVM sequence; there is no sequencer arbitration.
+    template<class REQUEST_SEQUENCE_ITEM_T>
+    class coroutine_t;
+
+    //--runs a coroutine sequence ahead, on a helper thread; its items are
+    //--randomised, converted to a driver's stimuli, and queued.
+    template<class REQUEST_SEQUENCE_ITEM_T, class INPUT_T>
+    class producer_t;
   } // namespace ::sequence
 
   namespace sequence::EXAMPLE::single_cycle_t
@@ -85,8 +146,18 @@
     class all_control_pairs_t;
     //--send randomly weighted control and data requests.
     class random_weighted_t;
+    //--send random requests, re-weighted from the live pair coverage.
+    class coverage_adaptive_t;
+    //--send the shortest walk of the control input pairs not yet covered.
+    class coverage_holes_t;
   } // namespace ::sequence::EXAMPLE::single_cycle_t
 
+  namespace sequence::EXAMPLE::single_cycle_t::coroutine
+  { // coroutine ports; the same items, as the same streams randomise them.
+    class random_loop_t;
+    class random_weighted_t;
+  } // namespace ::sequence::EXAMPLE::single_cycle_t::coroutine
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--class ::sequence::base_t
   //--common base type which provides some convenient member types.
@@ -103,6 +174,8 @@
       using item_t          = REQUEST_T;
       using sequence_item_t = REQUEST_T;
 
+      using random_engine_t = ::request::base_t::random_engine_t;
+
     private:    // forward declarations and type aliases
       using base_class_t
                = ::uvm::uvm_sequence<request_t, response_t>;
@@ -146,6 +219,10 @@
           ::uvm::uvm_report_fatal("USAGE", "This method is not reentrant.");
         m_spinning = true;
 
+        //--our random stream; afresh at each start
+        if  (p_sequencer != nullptr)
+          m_random_stream = p_sequencer->random_stream(base_class_t::get_name());
+
         //--do the real work
         do_body();
 
@@ -192,6 +269,8 @@
         , p_sequencer{}
         , m_count{count}
         , m_spinning{false}
+        , m_random_stream{}
+        , m_handle{}
       { /* noOp */ }
 
       virtual ~base_t() override
@@ -205,19 +284,68 @@
       base_t &operator=(base_t const &) = delete;
 
     protected:  // accessors
+      random_engine_t &random_stream()
+      { // our own random stream; see: body()
+        // NB: for sequences that draw for themselves; items randomise
+        //     from it in send_item(...).
+        return  m_random_stream;
+      }
+
     protected:  // methods
       void send_item(sequence_item_t &item)
       { // send the given item to the appropriate sequencer(s)
-        base_class_t::start_item(&item);
-        item.randomise();
-        base_class_t::finish_item(&item);
+        // NB: randomised from our own random stream; see: body().
+        // NB: where it can be, the item is lent, by handle; the driver
+        //     reads it in place until item_done(), whilst finish_item(...)
+        //     blocks.  It may not change, nor go away, before then.
+        if  constexpr (is_lendable)
+        {
+          if  (m_handle.is_handle())
+            ::uvm::uvm_report_fatal("USAGE", "An item is already lent.");
+          if  (item.is_handle())
+            ::uvm::uvm_report_fatal("USAGE", "A handle cannot be lent.");
+
+          base_class_t::start_item(&m_handle);
+          randomise(item);
+          m_handle.lend(item);
+          base_class_t::finish_item(&m_handle);
+          m_handle.release();
+        }
+        else
+        {
+          base_class_t::start_item(&item);
+          randomise(item);
+          base_class_t::finish_item(&item);
+        }
       }
 
     private:    // methods
-    private:    // types
+      void randomise(sequence_item_t &item)
+      { // from our own random stream, when started on a sequencer
+        // NB: deselected after; it goes with this sequence
+        ::request::base_t::random_stream(
+          (p_sequencer != nullptr) ? &m_random_stream : nullptr);
+        item.randomise();
+        ::request::base_t::random_stream(nullptr);
+      }
+
+    private:    // constants
+      //--items that may be lent, by handle; see: sequence_item.h
+      static bool constexpr is_lendable
+      {
+        requires (sequence_item_t &handle, sequence_item_t const &item)
+        {
+          handle.lend(item);
+          handle.release();
+          { item.is_handle() } -> ::std::same_as<bool>;
+        }
+      };
+
     private:    // attrbutes
-      unsigned  m_count;
-      bool      m_spinning;
+      unsigned         m_count;
+      bool             m_spinning;
+      random_engine_t  m_random_stream;  // split from the sequencer's seed
+      sequence_item_t  m_handle;         // lends the item sent; see: send_item(...)
   };  // class ::sequence::base_t
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -260,11 +388,7 @@
         SEQUENCE_ITEM_T item{};
         for  (auto ix [[maybe_unused]]:
                 ::std::ranges::views::iota(0u, base::count()))
-        {
-          base::start_item(&item);
-          item.randomise();
-          base::finish_item(&item);
-        }
+          base::send_item(item);
       }
 
     protected:  // c'tors and d'tor
@@ -275,11 +399,394 @@
     private:    // attrbutes
   };
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::coroutine_t<REQUEST_T>
+  //--common base type for coroutine sequences.
+  //--NB: do_body() is a coroutine; it co_yields items in place of
+  //--    send_item(...), and start(...) drives each as it is yielded,
+  //--    in the caller's thread.  Nothing is spawned, nothing is copied,
+  //--    and no item crosses a TLM port.
+  //--NB: the item is randomised from the sequence's own stream, named as
+  //--    the sequence; a port of a sequence, of the same name, has the
+  //--    same stimuli.  See: sequencer.h.
+  //--NB: the stream is selected only while an item randomises; it is
+  //--    deselected before the item is driven, thus a later draw on this
+  //--    thread never reads the stream of a sequence that has finished.
+  //--NB: do_body() marks its last item, co_yield ::coroutine::last(item),
+  //--    so that run ahead, it is finished on the caller's thread; see:
+  //--    producer_t.
+
+  template<class REQUEST_T>
+  class sequence::coroutine_t
+  {
+    public:     // forward declarations and type aliases
+      using request_t       = REQUEST_T;
+      using item_t          = REQUEST_T;
+      using sequence_item_t = REQUEST_T;
+
+      using random_engine_t = ::request::base_t::random_engine_t;
+
+      //--what do_body() returns; yields sequence items by reference
+      using items_t = ::coroutine::generator_t<sequence_item_t>;
+
+    public:     // c'tors and d'tor
+      virtual ~coroutine_t()
+      { /* noOp */ }
+
+      coroutine_t(coroutine_t const &) = delete;
+      coroutine_t &operator=(coroutine_t const &) = delete;
+
+    public:     // accessors
+      ::std::string const &get_name() const
+      { return  m_name; }
+
+      unsigned count() const
+      { // get the repeat count
+        return  m_count;
+      }
+
+      coroutine_t &count(unsigned const value)
+      { // set the repeat count
+        char const *error{nullptr};
+        if  (1 > value)
+          error = "Value assignment is illogical.";
+        else if  (m_spinning)
+          error = "The count cannot be changed mid-flight.";
+        else
+        { /* noOp */ }
+
+        if (error)
+          ::uvm::uvm_report_fatal("USAGE", error);
+
+        return  ((m_count=value), *this);
+      }
+
+    public:     // methods
+      virtual items_t do_body() = 0;  // a coroutine; yields the items.
+
+      template<class SEQUENCER_T, class DRIVER_T>
+      void start(SEQUENCER_T const &sequencer, DRIVER_T &driver)
+      { // drive every item do_body() yields, in turn.
+        // NB: the driver takes each item as it would from its port; see:
+        //     ::driver::EXAMPLE::single_cycle_t::drive_item(...).
+        //--error check
+        if  (m_spinning)
+          ::uvm::uvm_report_fatal("USAGE", "This method is not reentrant.");
+        m_spinning = true;
+
+        //--our random stream; afresh at each start
+        m_random_stream = sequencer.random_stream(m_name);
+
+        //--do the real work
+        driver.drive_begin();
+        for  (auto items{do_body()}; items.next();)
+        {
+          auto &item{items.value()};
+          ::request::base_t::random_stream(&m_random_stream);
+          item.randomise();
+          ::request::base_t::random_stream(nullptr);
+          driver.drive_item(item);
+        }
+        driver.drive_end();
+
+        //--remove the error check
+        m_spinning = false;
+
+        //--end of compilation unit with implicit return
+      }
+
+      template<class SEQUENCER_T, class DRIVER_T>
+      void start_ahead(SEQUENCER_T const &sequencer, DRIVER_T &driver)
+      { // as start(...), but the items are made ahead, on a helper thread;
+        // the driver takes their stimuli from a queue.
+        // NB: the same stimuli, in the same order; see: producer_t.
+        using input_t    = typename DRIVER_T::input_t;
+        using producer_t = ::sequence::producer_t<sequence_item_t, input_t>;
+
+        //--error check
+        if  (m_spinning)
+          ::uvm::uvm_report_fatal("USAGE", "This method is not reentrant.");
+        m_spinning = true;
+
+        //--do the real work
+        //--NB: the producer is large; not on the kernel thread's stack
+        auto const producer{::std::make_unique<producer_t>(do_body(),
+                                                           sequencer.random_stream(m_name),
+                                                           &DRIVER_T::stimuli)};
+        driver.drive_begin();
+        for  (input_t input{}; producer->get(input);)
+          driver.drive_input(input);
+        driver.drive_end();
+
+        //--remove the error check
+        m_spinning = false;
+
+        //--end of compilation unit with implicit return
+      }
+
+    protected:  // c'tors and d'tor
+      coroutine_t(::std::string const &name, unsigned const count)
+        : m_name{name}
+        , m_count{count}
+        , m_spinning{false}
+        , m_random_stream{}
+      { /* noOp */ }
+
+    private:    // attrbutes
+      ::std::string    m_name;
+      unsigned         m_count;
+      bool             m_spinning;
+      random_engine_t  m_random_stream;  // split from the sequencer's seed
+  };  // class ::sequence::coroutine_t
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::producer_t<REQUEST_T, INPUT_T>
+  //--pre-generates a coroutine sequence's stimuli on a helper thread.
+  //--NB: the helper resumes the coroutine, randomises each item from the
+  //--    sequence's stream, and converts it; the kernel's thread only
+  //--    dequeues.  The stream is the sequence's alone, and the items are
+  //--    taken in order, thus the stimuli are as start(...) drives them.
+  //--NB: the first item is made on the constructing thread; a coroutine
+  //--    constructs its items, UVM objects, before its first co_yield.  The
+  //--    helper stops at the item marked last, see: ::coroutine::last(...);
+  //--    the final resume, which destroys them, is made by get(...), and
+  //--    the frame by the d'tor, both on the consuming thread.  In between,
+  //--    the coroutine, randomise(), and the conversion touch nothing
+  //--    shared; see: request.h, and the driver's stimuli(...).
+  //--NB: a coroutine that marks no item last is finished by the helper; a
+  //--    coroutine port must mark it.
+  //--NB: the consumer spins, yielding its OS thread, whilst the queue is
+  //--    empty; the producer likewise, whilst it is full.
+
+  template<class REQUEST_T, class INPUT_T>
+  class sequence::producer_t final
+  {
+    public:     // forward declarations and type aliases
+      using sequence_item_t = REQUEST_T;
+      using input_t         = INPUT_T;
+      using items_t         = ::coroutine::generator_t<sequence_item_t>;
+      using random_engine_t = ::request::base_t::random_engine_t;
+      using convert_t       = input_t (*)(sequence_item_t const &);
+
+      //--stimuli queued ahead of the driver
+      static ::std::size_t constexpr queue_size{1024};
+
+    public:     // c'tors and d'tor
+      producer_t(items_t &&items, random_engine_t const &stream, convert_t const convert)
+        : m_items{::std::move(items)}
+        , m_stream{stream}
+        , m_convert{convert}
+        , m_queue{}
+        , m_first{}
+        , m_is_first{false}
+        , m_is_done{false}
+        , m_is_stopped{false}
+        , m_exception{}
+        , m_thread{}
+      {
+        //--the first item, here; see: NB
+        m_is_first = m_items.next();
+        if  (m_is_first)
+          m_first = make(m_items.value());
+        ::request::base_t::random_stream(nullptr);  // NB: ours is the helper's
+
+        //--the rest, there; up to the last, see: NB
+        if  (m_is_first and not m_items.is_last())
+          m_thread = ::std::thread{&producer_t::produce, this};
+        else
+          m_is_done.store(true, ::std::memory_order_release);
+      }
+
+      ~producer_t()
+      { // stop the helper, if still going; NB: before the frame goes
+        m_is_stopped.store(true, ::std::memory_order_release);
+        if  (m_thread.joinable())
+          m_thread.join();
+      }
+
+      producer_t(producer_t const &) = delete;
+      producer_t &operator=(producer_t const &) = delete;
+
+    public:     // methods
+      bool get(input_t &input)
+      { // the next stimuli, in order; false once the sequence is done.
+        if  (m_is_first)
+        {
+          input = m_first;
+          m_is_first = false;
+          return  true;
+        }
+
+        while  (not m_queue.try_get(input))
+        {
+          if  (m_is_done.load(::std::memory_order_acquire))
+          { // NB: the last may be put between the get and the load
+            if  (m_queue.try_get(input))
+              return  true;
+            if  (m_exception)
+              ::std::rethrow_exception(m_exception);
+            return  finish(input);
+          }
+          ::std::this_thread::yield();
+        }
+        return  true;
+      }
+
+    private:    // methods
+      input_t make(sequence_item_t &item)
+      { // randomise the given item from our stream, and convert it
+        ::request::base_t::random_stream(&m_stream);
+        item.randomise();
+        return  m_convert(item);
+      }
+
+      bool finish(input_t &input)
+      { // the final resume, here; see: NB.
+        // NB: items after the helper's last, if any, are made here too
+        if  (not m_items.next())
+          return  false;
+        input = make(m_items.value());
+        ::request::base_t::random_stream(nullptr);
+        return  true;
+      }
+
+      void produce()
+      { // the helper thread: every item after the first, up to the last,
+        // into the queue
+        try
+        {
+          bool is_going{true};
+          while  (is_going and not m_items.is_last() and m_items.next())
+          {
+            input_t const input{make(m_items.value())};
+            while  (is_going and not m_queue.try_put(input))
+            {
+              is_going = not m_is_stopped.load(::std::memory_order_acquire);
+              ::std::this_thread::yield();
+            }
+          }
+        }
+        catch (...)
+        { // NB: rethrown by get(...)
+          m_exception = ::std::current_exception();
+        }
+        m_is_done.store(true, ::std::memory_order_release);
+      }
+
+    private:    // attrbutes
+      items_t                                     m_items;       // resumed by the helper, to the last
+      random_engine_t                             m_stream;      // the sequence's; the helper's
+      convert_t                                   m_convert;     // item to stimuli
+      ::utility::spsc_queue_t<input_t, queue_size> m_queue;
+      input_t                                     m_first;       // see: NB
+      bool                                        m_is_first;    // true: m_first is yet to get
+      ::std::atomic<bool>                         m_is_done;     // true: nothing more is put
+      ::std::atomic<bool>                         m_is_stopped;  // true: the consumer is gone
+      ::std::exception_ptr                        m_exception;   // escaped the helper
+      ::std::thread                               m_thread;      // NB: last; first to go
+  };  // class ::sequence::producer_t
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::de_bruijn_t<N_BITS, N_TUPLE>
+  //--the de Bruijn sequence B(2**N_BITS, N_TUPLE); each symbol is one
+  //--cycle's worth of N_BITS bits.
+  //--NB: the cycle is k**n symbols long, for k symbols and tuples of n;
+  //--    every tuple occurs once in it, reading round from the end to the
+  //--    start.  Sent as a straight run, the first N_TUPLE-1 symbols are
+  //--    sent again at the end, see: size() and operator[](...).
+  //--NB: sending the cycle C times, then the first N_TUPLE-1 symbols once,
+  //--    covers every tuple C times.
+  //--NB: generated by the Fredricksen-Kessler-Maiorana algorithm; the
+  //--    concatenated Lyndon words, in lexicographic order.  Thus the first
+  //--    N_TUPLE symbols are all zero.
+
+  template<unsigned N_BITS, unsigned N_TUPLE>
+  class sequence::de_bruijn_t final
+  {
+    public:     // forward declarations and type aliases
+      using symbol_t = unsigned;
+
+      static_assert(
+        ((N_BITS >= 1) and (N_BITS < 16)),
+        "Symbols must have from one to fifteen bits.");
+      static_assert(
+        (N_TUPLE >= 1),
+        "Tuples must have at least one symbol.");
+
+      // number of distinct symbols; the alphabet
+      static symbol_t constexpr N_SYMBOLS{1u << N_BITS};
+
+      // symbols in the cycle; N_SYMBOLS ** N_TUPLE
+      static ::std::size_t constexpr CYCLE_LENGTH{
+        []()
+        {
+          ::std::size_t length{1};
+          for  (auto ix [[maybe_unused]]: ::std::ranges::views::iota(0u, N_TUPLE))
+            length = (length * N_SYMBOLS);
+          return  length;
+        }()};
+      // symbols in a straight run covering every tuple once
+      static ::std::size_t constexpr LENGTH{CYCLE_LENGTH + N_TUPLE - 1};
+
+    public:     // c'tors and d'tor
+      de_bruijn_t()
+        : m_cycle{}
+      {
+        m_cycle.reserve(CYCLE_LENGTH);
+        ::std::vector<symbol_t> word(N_TUPLE + 1, 0);
+        generate(word, 1, 1);
+      }
+
+    public:     // accessors
+      ::std::size_t size() const
+      { // symbols in a straight run covering every tuple once
+        return  LENGTH;
+      }
+
+      symbol_t operator[](::std::size_t const index) const
+      { // the index-th symbol; round the cycle, for any index
+        return  m_cycle[index % CYCLE_LENGTH];
+      }
+
+      ::std::vector<symbol_t> const &cycle() const
+      { return  m_cycle; }
+
+    private:    // methods
+      void generate(::std::vector<symbol_t> &word,
+                    unsigned const           t,
+                    unsigned const           p)
+      { // append the Lyndon words, in order, whose lengths divide N_TUPLE;
+        // word[1..t-1] is the prefix so far, of period p.
+        if  (t > N_TUPLE)
+        {
+          if  ((N_TUPLE % p) == 0)
+            for  (auto const ix: ::std::ranges::views::iota(1u, p + 1))
+              m_cycle.push_back(word[ix]);
+          return;
+        }
+
+        word[t] = word[t - p];
+        generate(word, t + 1, p);
+        for  (auto const symbol: ::std::ranges::views::iota(word[t - p] + 1, N_SYMBOLS))
+        {
+          word[t] = symbol;
+          generate(word, t + 1, t);
+        }
+      }
+
+    private:    // attrbutes
+      ::std::vector<symbol_t> m_cycle;  // CYCLE_LENGTH symbols
+  };
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--class ::sequence::EXAMPLE::single_cycle_t::all_control_pairs_t
   // Test all controls pairs by force
-  // NB:  There are five (5) current control bits and the sequence hard code
-  //      that - maybe I can general it later.
+  // NB:  There are five (5) current control bits; each cycle's control
+  //      bits are one symbol of a de Bruijn sequence of pairs, B(32, 2),
+  //      thus every ordered pair occurs once per iteration, in 1024 cycles
+  //      rather than 2048.
+  // NB:  The iterations are one continuous run round the cycle; the pairs
+  //      across iteration boundaries are pairs of the cycle, too.
 
   class sequence::EXAMPLE::single_cycle_t::all_control_pairs_t
     : public ::sequence::base_t<::sequence_item::EXAMPLE::single_cycle_t>
@@ -306,12 +813,9 @@
       virtual void do_body() override
       { // send the complete sequence.
         //--locals
-        // all possible two-cycle combinations of five control bits
-        unsigned constexpr bit_count{5};
-        unsigned constexpr bit_mask{compl ((compl 0u) << bit_count)};
-        unsigned constexpr sequence_cycles{2};
-        unsigned constexpr sequence_bits{bit_count * sequence_cycles};
-        unsigned constexpr sequence_count{1u << sequence_bits};
+        de_bruijn_t const     symbols{};
+        ::std::size_t const   cycles{(count() * de_bruijn_t::CYCLE_LENGTH) +
+                                     (tuple_cycles - 1)};
 
         sequence_item_t item{};
         sequence_item_t::value_fixed_t request{};
@@ -319,41 +823,25 @@
         //--spin iterations of all pairs.
         //--NB: first control-bit combination is all resets.
         using ::std::ranges::views::iota;
-        for (auto const iteration [[maybe_unused]]: iota(0u, count()))
-        { // each iteration covers all combinations of control bit sequences
-          for (auto const sequence: iota(0u, sequence_count))
-          { // all combinations
-            for (auto const cycle: iota(0u, sequence_cycles))
-            { // one cycle's worth of control bits
-              //--take the high order bits first
-              auto const block{sequence_cycles - cycle - 1};
-              auto const shift{block * bit_count};
-              auto const raw  {sequence >> shift};
-              auto const bits {bit_mask bitand raw};
-
-              //--set up the the control bits for the DUT/MUT
-              //--NB: std::format not supported in GNU 12.2 compiler
-              using ::utility::format::binary;
-              std::ostringstream prefix{};
-              prefix
-                << "SEQUENCE " << binary(sequence, sequence_bits)
-                << ": cycle (" << (cycle+1) << '/' << sequence_cycles
-                << "), bits(" << binary(bits, bit_count) << ')';
-              request.set_prefix(prefix.str());
-
-              request.set_control
-              (
-                (0x01 bitand (bits >> 4)),  // reset
-                (0x01 bitand (bits >> 3)),  // is_advance
-                (0x01 bitand (bits >> 2)),  // is_error
-                (0x01 bitand (bits >> 1)),  // is_flush
-                (0x01 bitand (bits >> 0))   // is_valid
-              );
-
-              //--send the bits to the DUT/MUT
-              send_item(item.set(request));
-            }
-          }
+        for (auto const cycle: iota(::std::size_t{0}, cycles))
+        { // one cycle's worth of control bits
+          auto const bits{symbols[cycle]};
+
+          //--set up the the control bits for the DUT/MUT
+          //--NB: a deferred label; formatted only if read, see: prefix(...)
+          request.set_prefix({&prefix, {(cycle % de_bruijn_t::CYCLE_LENGTH), bits}});
+
+          request.set_control
+          (
+            (0x01 bitand (bits >> 4)),  // reset
+            (0x01 bitand (bits >> 3)),  // is_advance
+            (0x01 bitand (bits >> 2)),  // is_error
+            (0x01 bitand (bits >> 1)),  // is_flush
+            (0x01 bitand (bits >> 0))   // is_valid
+          );
+
+          //--send the bits to the DUT/MUT
+          send_item(item.set(request));
         }
 
         //--hold the output for two cycles
@@ -368,7 +856,25 @@
     protected:  // accessors
     protected:  // methods
     private:    // methods
+      static ::std::string prefix(::label::arguments_t const &arguments)
+      { // the text of one cycle's label; the cycle in the iteration, its bits
+        // NB: std::format not supported in GNU 12.2 compiler
+        using ::utility::format::binary;
+        std::ostringstream text{};
+        text
+          << "DE BRUIJN B(" << de_bruijn_t::N_SYMBOLS << ',' << tuple_cycles
+          << "): cycle (" << (arguments[0] + 1)
+          << '/' << de_bruijn_t::CYCLE_LENGTH
+          << "), bits(" << binary(arguments[1], bit_count) << ')';
+        return  text.str();
+      }
+
     private:    // types
+      // all possible two-cycle combinations of five control bits
+      static unsigned constexpr bit_count{5};
+      static unsigned constexpr tuple_cycles{2};
+      using de_bruijn_t = ::sequence::de_bruijn_t<bit_count, tuple_cycles>;
+
     private:    // attrbutes
   }; // class ::sequence::EXAMPLE::single_cycle_t::all_control_pairs_t
 
@@ -432,6 +938,280 @@
     private:    // attrbutes
   }; // class ::sequence::EXAMPLE::single_cycle_t::random_weighted_t
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::EXAMPLE::single_cycle_t::coverage_adaptive_t
+  // As random_weighted_t, but the control inputs chase coverage: each
+  //    cycle's control bits are drawn given the last cycle's, from weights
+  //    re-computed, every interval() cycles, from the live counts of the
+  //    control_bit_pairs_t score board.  Pairs not yet observed, such as
+  //    reset-with-error, are drawn in far fewer cycles than by chance.
+  // Start by sending two resets so at known state
+  // End by sending two holds to let last random work it way thru.
+  //
+  // NB: The count is either COUNT_DEFAULT or inputted when calling the test.
+  // NB: Without coverage(...), the weights never adapt; every pair is
+  //     equally likely.
+  // NB: The control bits are as the score board's, and all_control_pairs_t's;
+  //     reset, is_advance, is_error, is_flush, is_valid, from bit 4 down.
+  //     See: ::distribution::transition_t.
+  // NB: The live counts lag what is driven; the driver may buffer stimuli,
+  //     see: --method-process, and with time warp the monitor and score
+  //     board run behind it, by an interval or more.  Thus it adapts to the
+  //     pairs it drove itself as well, the greater of the two counts; a
+  //     pair driven is never a hole, however far behind the score board.
+
+  class sequence::EXAMPLE::single_cycle_t::coverage_adaptive_t
+    : public ::sequence::base_t<::sequence_item::EXAMPLE::single_cycle_t>
+  {
+    public:     // forward declarations and type aliases
+      static unsigned constexpr COUNT_DEFAULT{20 * 1000};
+      static unsigned constexpr INTERVAL_DEFAULT{64};
+
+      //--one per combination of the five control inputs
+      static ::std::size_t constexpr N_COMBINATIONS{32};
+      using transition_t = ::distribution::transition_t<N_COMBINATIONS>;
+      using counts_t     = transition_t::counts_t;
+
+    public:     // UVM evil
+    public:     // c'tors and d'tor
+      coverage_adaptive_t()
+        : base_t{
+            "::sequence::EXAMPLE::single_cycle_t::coverage_adaptive_t",
+            COUNT_DEFAULT}
+        , m_coverage{nullptr}
+        , m_interval{INTERVAL_DEFAULT}
+        , m_transition{}
+        , m_counts{}
+      { /* noOp */ }
+      virtual ~coverage_adaptive_t() override
+      { /* noOp */ }
+
+      coverage_adaptive_t(coverage_adaptive_t const &) = delete;
+      coverage_adaptive_t &operator=(coverage_adaptive_t const &) = delete;
+
+    public:     // accessors
+      coverage_adaptive_t &coverage(counts_t const *const counts)
+      { // the live pair counts to adapt to; [prior][next]
+        // NB: e.g. the control_bit_pairs_t score board's check_array
+        m_coverage = counts;
+        return  *this;
+      }
+
+      unsigned interval() const
+      { return  m_interval; }
+
+      coverage_adaptive_t &interval(unsigned const value)
+      { // set the cycles between adaptations
+        if  (1 > value)
+          ::uvm::uvm_report_fatal("USAGE", "Value assignment is illogical.");
+        return  ((m_interval=value), *this);
+      }
+
+    public:     // methods
+      virtual void do_body() override
+      { // send reset/reset/a number of adaptive random requests/hold/hold.
+        //--locals
+        sequence_item_t item{};
+        sequence_item_t::value_fixed_t request{};
+        request.set_prefix("COVERAGE ADAPTIVE");
+
+        //--a couple reset cycles so a know state
+        //--NB: a reset's control bits are all zero
+        item.select<sequence_item_t::reset_t>();
+        send_item(item);
+        send_item(item);
+        m_transition = transition_t{};
+        m_transition.prior(0);
+        for  (auto &row: m_counts)
+          ::std::ranges::fill(row, 0u);
+
+        //--send the adaptive random inputs
+        bool is_reported{false};
+        ::std::size_t prior{0};
+        using ::std::ranges::views::iota;
+        for (auto const index: iota(0u, count()))
+        {
+          //--re-weigh from the live counts, now and then; see: NB
+          if  ((m_coverage != nullptr) and ((index % m_interval) == 0))
+          {
+            merge();
+            m_transition.adapt(m_counts);
+            if  (not is_reported and is_complete())
+            {
+              is_reported = true;
+              ::uvm::uvm_report_info("COVERAGE",
+                                     ("control input pairs complete, as driven, after " +
+                                      ::std::to_string(index) + " cycles"));
+            }
+          }
+
+          //--one draw for the control inputs, one for the debug values
+          auto const bits  {m_transition(random_stream()())};
+          auto const values{random_stream()()};
+          m_counts[prior][bits] = (m_counts[prior][bits] + 1);
+          prior = bits;
+          request.set_control
+          (
+            (0x01 bitand (bits >> 4)),  // reset
+            (0x01 bitand (bits >> 3)),  // is_advance
+            (0x01 bitand (bits >> 2)),  // is_error
+            (0x01 bitand (bits >> 1)),  // is_flush
+            (0x01 bitand (bits >> 0))   // is_valid
+          );
+          request.set_instruction(static_cast<::model::i_binary_t>(values),
+                                  static_cast<::model::i_number_t>(values >> 32));
+          send_item(item.set(request));
+        }
+
+        //--hold state due to system lag/hysteresis
+        item.select<sequence_item_t::hold_t>();
+        send_item(item);
+        send_item(item);
+
+        //--end of compilation unit with implicit return
+      }
+
+    protected:  // c'tors and d'tor
+    protected:  // accessors
+    protected:  // methods
+    private:    // methods
+      void merge()
+      { // the greater of the live counts and ours; see: NB
+        using ::std::ranges::views::iota;
+        for  (auto const prior: iota(::std::size_t{0}, N_COMBINATIONS))
+          for  (auto const next: iota(::std::size_t{0}, N_COMBINATIONS))
+            m_counts[prior][next] = ::std::max(m_counts[prior][next], (*m_coverage)[prior][next]);
+      }
+
+      bool is_complete() const
+      { // every pair observed, or driven?
+        for  (auto const &row: m_counts)
+          for  (auto const count: row)
+            if  (count == 0)
+              return  false;
+        return  true;
+      }
+
+    private:    // types
+    private:    // attrbutes
+      counts_t const *m_coverage;    // not ours; nullptr: never adapt
+      unsigned        m_interval;    // cycles between adaptations
+      transition_t    m_transition;  // the weights, given the last bits
+      counts_t        m_counts;      // adapted to; the live, or ours, see: NB
+  }; // class ::sequence::EXAMPLE::single_cycle_t::coverage_adaptive_t
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::EXAMPLE::single_cycle_t::coverage_holes_t
+  // Close the control input pair coverage, by force
+  // NB:  The holes are read from the live counts of the control_bit_pairs_t
+  //      score board, when started; the walk is the shortest that takes
+  //      each, or within a cycle of it.  See: ::coverage::hole_walk(...).
+  // NB:  Start by sending two resets so at known state; a reset's control
+  //      bits are all zero, the walk's prior.
+  // NB:  The control bits are as all_control_pairs_t's, and labelled
+  //      likewise, with deferred labels.
+
+  class sequence::EXAMPLE::single_cycle_t::coverage_holes_t
+    : public ::sequence::base_t<::sequence_item::EXAMPLE::single_cycle_t>
+  {
+    public:     // forward declarations and type aliases
+      //--one per combination of the five control inputs
+      using counts_t = ::coverage::counts_t<32>;
+
+    public:     // UVM evil
+    public:     // c'tors and d'tor
+      coverage_holes_t()
+        : base_t{"::sequence::EXAMPLE::single_cycle_t::coverage_holes_t"}
+        , m_coverage{nullptr}
+      { /* noOp */ }
+      virtual ~coverage_holes_t() override
+      { /* noOp */ }
+
+      coverage_holes_t(coverage_holes_t const &) = delete;
+      coverage_holes_t &operator=(coverage_holes_t const &) = delete;
+
+    public:     // accessors
+      coverage_holes_t &coverage(counts_t const *const counts)
+      { // the live pair counts to close; [prior][next]
+        // NB: e.g. the control_bit_pairs_t score board's check_array
+        m_coverage = counts;
+        return  *this;
+      }
+
+    public:     // methods
+      virtual void do_body() override
+      { // send reset/reset/the walk/hold/hold.
+        //--error check
+        if  (m_coverage == nullptr)
+          ::uvm::uvm_report_fatal("USAGE", "There is no coverage to close.");
+
+        //--locals
+        sequence_item_t item{};
+        sequence_item_t::value_fixed_t request{};
+
+        //--a couple reset cycles so a know state
+        item.select<sequence_item_t::reset_t>();
+        send_item(item);
+        send_item(item);
+
+        //--the walk, from the resets
+        auto const walk{::coverage::hole_walk<32>(*m_coverage, 0)};
+        ::uvm::uvm_report_info("COVERAGE",
+                               (::std::to_string(::coverage::holes<32>(*m_coverage)) +
+                                " control input pairs not covered; closing in " +
+                                ::std::to_string(walk.size()) + " cycles"));
+
+        using ::std::ranges::views::iota;
+        for (auto const cycle: iota(::std::size_t{0}, walk.size()))
+        { // one cycle's worth of control bits
+          auto const bits{walk[cycle]};
+
+          //--NB: a deferred label; formatted only if read, see: prefix(...)
+          request.set_prefix({&prefix, {cycle, bits}});
+
+          request.set_control
+          (
+            (0x01 bitand (bits >> 4)),  // reset
+            (0x01 bitand (bits >> 3)),  // is_advance
+            (0x01 bitand (bits >> 2)),  // is_error
+            (0x01 bitand (bits >> 1)),  // is_flush
+            (0x01 bitand (bits >> 0))   // is_valid
+          );
+
+          //--send the bits to the DUT/MUT
+          send_item(item.set(request));
+        }
+
+        //--hold the output for two cycles
+        item.select<sequence_item_t::hold_t>();
+        send_item(item);
+        send_item(item);
+
+        //--end of compilation unit with implicit return
+      }
+
+    protected:  // c'tors and d'tor
+    protected:  // accessors
+    protected:  // methods
+    private:    // methods
+      static ::std::string prefix(::label::arguments_t const &arguments)
+      { // the text of one cycle's label; the cycle in the walk, its bits
+        // NB: std::format not supported in GNU 12.2 compiler
+        using ::utility::format::binary;
+        std::ostringstream text{};
+        text
+          << "COVERAGE HOLE: cycle (" << (arguments[0] + 1)
+          << "), bits(" << binary(arguments[1], bit_count) << ')';
+        return  text.str();
+      }
+
+    private:    // types
+      static unsigned constexpr bit_count{5};
+
+    private:    // attrbutes
+      counts_t const *m_coverage;  // not ours
+  }; // class ::sequence::EXAMPLE::single_cycle_t::coverage_holes_t
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   
   //--class ::sequence::EXAMPLE::single_cycle_t::random_loop_t
@@ -725,6 +1505,103 @@
     private:    // attrbutes
   }; // class ::sequence::EXAMPLE::single_cycle_t::error_w_advance_valid_t
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--coroutine ports
+  //--NB: GNU 12.2 lowers a coroutine body to a switch without a default;
+  //--    -Wswitch-default is moot for the bodies.
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wswitch-default"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::EXAMPLE::single_cycle_t::coroutine::random_loop_t
+  //--as random_loop_t; co_yield for send_item(...).
+
+  class sequence::EXAMPLE::single_cycle_t::coroutine::random_loop_t
+    : public ::sequence::coroutine_t<::sequence_item::EXAMPLE::single_cycle_t>
+  {
+    public:     // forward declarations and type aliases
+      static unsigned constexpr COUNT_DEFAULT{20 * 1000};
+
+    public:     // c'tors and d'tor
+      random_loop_t()
+        : coroutine_t{
+            "::sequence::EXAMPLE::single_cycle_t::random_loop_t",
+            COUNT_DEFAULT}
+      { /* noOp */ }
+      virtual ~random_loop_t() override
+      { /* noOp */ }
+
+    public:     // methods
+      virtual items_t do_body() override
+      {
+        //--spin out the possible sequence items used.
+        sequence_item_t reset {sequence_item_t::reset_t{}};
+        sequence_item_t hold  {sequence_item_t::hold_t{}};
+        sequence_item_t random{sequence_item_t::random_weighted_t{}};
+
+        //--a couple reset cycles so a know state
+        co_yield reset;
+        co_yield reset;
+
+        using ::std::ranges::views::iota;
+        for (auto const index [[maybe_unused]]: iota(0u, count()))
+          co_yield random;
+
+        //--hold state due to system lag/hysteresis
+        co_yield hold;
+        co_yield ::coroutine::last(hold);
+
+        //--end of compilation unit with implicit return
+      }
+  }; // class ::sequence::EXAMPLE::single_cycle_t::coroutine::random_loop_t
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::sequence::EXAMPLE::single_cycle_t::coroutine::random_weighted_t
+  //--as random_weighted_t; co_yield for send_item(...).
+
+  class sequence::EXAMPLE::single_cycle_t::coroutine::random_weighted_t
+    : public ::sequence::coroutine_t<::sequence_item::EXAMPLE::single_cycle_t>
+  {
+    public:     // forward declarations and type aliases
+      static unsigned constexpr COUNT_DEFAULT{20 * 1000};
+
+    public:     // c'tors and d'tor
+      random_weighted_t()
+        : coroutine_t{
+            "::sequence::EXAMPLE::single_cycle_t::random_weighted_t",
+            COUNT_DEFAULT}
+      { /* noOp */ }
+      virtual ~random_weighted_t() override
+      { /* noOp */ }
+
+    public:     // methods
+      virtual items_t do_body() override
+      { // send reset/reset/a number of weighted random sequences/hold/hold.
+        //--locals
+        sequence_item_t item{};
+
+        //--a couple reset cycles so a know state
+        item.select<sequence_item_t::reset_t>();
+        co_yield item;
+        co_yield item;
+
+        //--send the weighted random inputs
+        item.select<sequence_item_t::random_weighted_t>();
+        using ::std::ranges::views::iota;
+        for (auto const index [[maybe_unused]]: iota(0u, count()))
+          co_yield item;
+
+        //--hold state due to system lag/hysteresis
+        item.select<sequence_item_t::hold_t>();
+        co_yield item;
+        co_yield ::coroutine::last(item);
+
+        //--end of compilation unit with implicit return
+      }
+  }; // class ::sequence::EXAMPLE::single_cycle_t::coroutine::random_weighted_t
+
+# pragma GCC diagnostic pop
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--deferred declarations
   //--NB: see comments at top of file
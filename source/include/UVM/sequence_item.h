@@ -19,8 +19,17 @@
 //  - sequence items for all DUTs/MUTs
 //  - mostly based on a ::std::variant as the data container.
 //
+//  Design Decisions:
+//  - EXAMPLE::single_cycle_t may be a handle: an item lent another item,
+//    see: lend(...).  A handle copies as a handle, so the driver's copy,
+//    made by get_next_item(...), is a pointer rather than the variant;
+//    the driver reads the lent item in place, see: referent().
+//  - a lent item belongs to its sequence; it is valid, and unchanged,
+//    until the driver's item_done(), see: ::sequence::base_t.
+//
 //  NOTES:
 //  2024-07-18: Moore, Peimann: created.
+//  2026-10-16: EXAMPLE::single_cycle_t may be a handle to a lent item.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -164,13 +173,52 @@
                      REQUEST_T const        request)
         : base_t{name}
         , m_variant{request}
+        , m_referent{nullptr}
+      { /* noOp */ }
+
+      single_cycle_t(single_cycle_t const &other)
+        : base_t{other}
+        , m_variant{other.m_variant}
+        , m_referent{other.m_referent}
       { /* noOp */ }
 
+      single_cycle_t &operator=(single_cycle_t const &other)
+      { // NB: from a handle, only the handle is copied; see: lend(...)
+        if  (this == &other)
+          return  *this;
+
+        m_referent = other.m_referent;
+        if  (m_referent == nullptr)
+        {
+          base_t::operator=(other);
+          m_variant = other.m_variant;
+        }
+        return  *this;
+      }
+
       virtual ~single_cycle_t() override final
       { /* noOp */ }
 
     public:     // accessors
+      bool is_handle() const
+      { return  (m_referent != nullptr); }
+
+      single_cycle_t const &referent() const
+      { // the lent item, when a handle; otherwise, this item
+        return  is_handle() ? *m_referent : *this;
+      }
+
     public:     // methods
+      void lend(single_cycle_t const &item)
+      { // become a handle to the given item; NB: not to a handle
+        m_referent = &(item.referent());
+      }
+
+      void release()
+      { // no longer a handle
+        m_referent = nullptr;
+      }
+
       template<typename TYPE_T>
       bool constexpr holds() const
       { // one possibility for contained type ascertation
@@ -255,7 +303,8 @@
 
     private:    // methods
     private:    // attributes
-      variant_t m_variant;
+      variant_t             m_variant;
+      single_cycle_t const *m_referent;  // lent; nullptr: not a handle
   }; // class ::sequence_item::EXAMPLE::single_cycle_t
 
   //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -20,6 +20,10 @@
 //
 //  NOTES:
 //  2024-07-18: Moore, Peimann: created.
+//  2026-10-16: each sequencer owns a random stream, seeded from the
+//              config_db key "random_seed".
+//  2026-10-16: "random_seed" is the master seed; each sequence's stream
+//              is split from it by name, see: random_stream(...).
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,7 +32,8 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <cstdint>
+# include <string>
 
   //--required library includes
   // <none>
@@ -36,6 +41,8 @@
   //--required project includes
 # include "UVM_wrapper.h"
 
+# include "prng.h"
+# include "request.h"
 # include "sequence_item.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -64,7 +71,10 @@
   //--base class for sequencers.
   //--NB: non-instantiable.
   //--NB: declares common type names for convenience.
-  //--NB: nothing else particularly special here.
+  //--NB: holds the master seed that its sequences' random streams are
+  //--    split from; a stream's seed is that of its hierarchical name, thus
+  //--    each sequence on each replicated instance draws an independent,
+  //--    repeatable stream, whatever runs before or beside it.
 
   template <class REQUEST_T, class RESPONSE_T>
   class sequencer::base_t
@@ -79,6 +89,8 @@
       using item_t          = REQUEST_T;
       using sequence_item_t = REQUEST_T;
 
+      using random_engine_t = ::request::base_t::random_engine_t;
+
     private:    // forward declarations and type aliases
       using base_class_t
               = ::uvm::uvm_sequencer<request_t, response_t>;
@@ -86,16 +98,47 @@
     public:     // UVM evil
     public:     // c'tors and d'tor
     public:     // accessors
+      ::std::uint64_t random_seed() const
+      { return  m_random_seed; }
+
+      void random_seed(::std::uint64_t const seed)
+      { // the master seed; NB: e.g. a fork server's child, reseeded
+        m_random_seed = seed;
+      }
+
+      random_engine_t random_stream(::std::string const &name) const
+      { // the stream of the named sequence, as started on this sequencer
+        // NB: the same name, the same stream; a sequence run twice on one
+        //     sequencer repeats its stimuli, unless renamed.
+        return  random_engine_t{::prng::stream_seed(m_random_seed,
+                                                    (this->get_full_name() + "." + name))};
+      }
+
     public:     // methods
+      void build_phase(::uvm::uvm_phase &phase) override
+      {
+        //--parent class behaviour as a pre-method
+        base_class_t::build_phase(phase);
+
+        //--the master seed; by default, as the common generator
+        ::uvm::uvm_config_db<::std::uint64_t>::get(this, "", "random_seed", m_random_seed);
+
+        //--end of compilation unit with implicit return
+      }
+
     protected:  // c'tors and d'tor
       base_t()
         : base_t{"::sequencer::base_t"}
       { /* noOp */ }
       base_t(::uvm::uvm_component_name name)
         : base_class_t{name}
+        , m_random_seed{random_engine_t::default_seed}
       { /* noOp */ }
       virtual ~base_t() override
       { /* noOp */ }
+
+    private:    // attributes
+      ::std::uint64_t m_random_seed;  // see: random_stream(...)
   };
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -20,6 +20,30 @@
 //
 //  NOTES:
 //  2024-08-24: Moore, Peimann: created.
+//  2026-10-16: single_cycle_t runs its sequences on every replicated
+//              instance, concurrently.
+//  2026-10-16: single_cycle_t forks a child per seed after reset, when
+//              it is a fork server; see: fork_server.h.
+//  2026-10-16: single_cycle_t runs each sequence on every instance, in
+//              lockstep; it checkpoints after the resets and after each
+//              sequence, and continues from a restored checkpoint; see:
+//              checkpoint.h.
+//  2026-10-16: single_cycle_t checkpoints each instance's master seed,
+//              rather than its stream; it runs one sequence alone, when
+//              asked, see: config_db key "sequence".
+//  2026-10-16: single_cycle_t runs the coroutine port of a sequence, where
+//              there is one, when asked; see: config_db key "is_coroutine".
+//  2026-10-16: single_cycle_t records the first instance's stimuli, and
+//              plays recorded stimuli back in place of the resets and the
+//              sequences; see: config_db keys "record_file", "playback_file".
+//  2026-10-16: single_cycle_t runs coroutine ports ahead, on helper threads,
+//              when asked; see: config_db key "is_ahead".
+//  2026-10-16: single_cycle_t runs coverage_adaptive_t in place of
+//              random_weighted_t, adapting to each instance's pair counts,
+//              when asked; see: config_db key "is_adaptive".
+//  2026-10-16: single_cycle_t closes each instance's control input pair
+//              coverage with a directed walk, after the sequences, when
+//              asked; see: config_db key "is_closing".
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,16 +52,27 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <memory>
+# include <ranges>
+# include <string>
+# include <vector>
 
   //--required library includes
   // <none>
 
   //--required project includes
 # include "UVM_wrapper.h"
+# include "checkpoint.h"
+# include "fork_server.h"
 
+# include "request.h"
+# include "score_board.h"
 # include "sequence.h"
 # include "test_bench.h"
+# include "transaction.h"
 # include "utility.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -186,6 +221,20 @@
     public:    // c'tors and d'tor
       single_cycle_t(::uvm::uvm_component_name name)
         : base_t{name}
+        , m_checkpoint_file{}
+        , m_position{0}
+        , m_is_restored{false}
+        , m_is_alone{false}
+        , m_alone{0}
+        , m_is_coroutine{false}
+        , m_is_ahead{false}
+        , m_is_adaptive{false}
+        , m_is_closing{false}
+        , m_record_file{}
+        , m_playback_file{}
+        , m_recorder{}
+        , m_playback{}
+        , m_records{}
       { /* noOp */ }
 
       ~single_cycle_t() override
@@ -198,6 +247,35 @@
         //--defer to parent class
         //--NB: builds the test_bench
         base_t::build_phase(phase);
+
+        //--checkpoint after the resets and after each sequence, when asked
+        ::uvm::uvm_config_db<::std::string>::get(this, "", "checkpoint_file", m_checkpoint_file);
+
+        //--run one sequence alone, after the resets, when asked
+        //--NB: its stimuli are as in a full run; see: sequencer.h
+        m_is_alone = ::uvm::uvm_config_db<::std::uint64_t>::get(this, "", "sequence", m_alone);
+        if  (m_is_alone and (m_alone >= sequence_count))
+          uvm_report_fatal("SEQUENCE",
+                           ("No sequence at position " + ::std::to_string(m_alone) +
+                            "; there are " + ::std::to_string(sequence_count) + "."));
+
+        //--the driver pulls from coroutine sequences, where ported, when asked
+        //--NB: the same stimuli; see: ::sequence::coroutine_t
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_coroutine", m_is_coroutine);
+        //--and runs them ahead, on helper threads, when asked
+        //--NB: the same stimuli, again; see: ::sequence::producer_t
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_ahead", m_is_ahead);
+
+        //--chase the pairs each score board has yet to observe, when asked
+        //--NB: different stimuli; see: run_sequence(...)
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_adaptive", m_is_adaptive);
+
+        //--close the pair coverage left incomplete, when asked
+        ::uvm::uvm_config_db<bool>::get(this, "", "is_closing", m_is_closing);
+
+        //--record stimuli, or play them back, when asked; see: stimulus.h
+        ::uvm::uvm_config_db<::std::string>::get(this, "", "record_file", m_record_file);
+        ::uvm::uvm_config_db<::std::string>::get(this, "", "playback_file", m_playback_file);
       }
 
       void end_of_elaboration_phase(uvm::uvm_phase& phase) override
@@ -207,37 +285,78 @@
         base_t::end_of_elaboration_phase(phase);
       }
 
+      void start_of_simulation_phase(uvm::uvm_phase& phase) override
+      {
+        //--defer to parent class
+        base_t::start_of_simulation_phase(phase);
+
+        //--a restored run continues from its checkpoint
+        //--NB: before the simulation starts; see: ::vif::EXAMPLE
+        ::std::string restore_file{};
+        if  (::uvm::uvm_config_db<::std::string>::get(this, "", "restore_file", restore_file))
+          restore(restore_file);
+      }
+
       void run_phase(uvm::uvm_phase& phase) override
       {
         //--defer to parent class
         base_t::run_phase(phase);
 
         phase.raise_objection(this);
-        auto sequencer{&(test_bench().environment().agent().sequencer())};
 
-        if  (true)
+        //--a recorded run replaces the resets and the sequences
+        //--NB: every instance plays the one mapping
+        if  (not m_playback_file.empty())
         {
-          namespace seq_t = ::sequence::EXAMPLE::single_cycle_t;
-          using seq_item_t = ::sequence_item::EXAMPLE::single_cycle_t;
+          m_playback.reset(new stimulus_image_t{m_playback_file});
+          run_instances(&single_cycle_t::run_playback);
+          phase.drop_objection(this);
+          return;
+        }
 
-          ::std::vector<::sequence::base_t<seq_item_t>*> sequences
-          {
-            new ::sequence::repeat_t<seq_item_t>,
-            new ::sequence::repeat_t<seq_item_t, 1>{},
-            new ::sequence::repeat_t<seq_item_t>{5},
-            new seq_t::all_control_pairs_t{},
-            new seq_t::random_weighted_t{},
-            new seq_t::random_loop_t{},
-            new seq_t::flush_w_advance_never_advances_t{},
-            new seq_t::error_w_advance_valid_t{},
-            new seq_t::reset_advance_with_out_valid_t{},
-          };
-
-          for (auto sequence: sequences)
-          {
-            uvm_report_info("SEQUENCE_START", sequence->get_name());
-            sequence->start(sequencer);
-          }
+        //--record the first instance's stimuli, when asked
+        auto &driver{test_bench().environment().agent(0).driver()};
+        if  (not m_record_file.empty())
+        {
+          m_recorder.reset(new stimulus_writer_t{m_record_file});
+          driver.record_to(m_recorder.get());
+        }
+
+        //--every instance is reset, then runs the sequences in lockstep
+        //--NB: a restored run was reset before its checkpoint
+        //--NB: a fork server forks its children after the reset, or the
+        //      restore; each child runs the remaining sequences
+        if  (not m_is_restored)
+        {
+          run_instances(&single_cycle_t::run_resets);
+          checkpoint();
+        }
+        fork_point();
+        ::std::uint64_t end{sequence_count};
+        if  (m_is_alone)
+        {
+          m_position = m_alone;
+          end        = (m_alone + 1);
+        }
+        while  (m_position < end)
+        {
+          run_instances(&single_cycle_t::run_sequence);
+          m_position = (m_position + 1);
+          checkpoint();
+        }
+
+        //--close each instance's pair coverage, when asked and incomplete
+        if  (m_is_closing)
+          run_instances(&single_cycle_t::run_holes);
+
+        if  (m_recorder)
+        {
+          driver.record_to(nullptr);
+          m_recorder->close();
+          uvm_report_info("STIMULUS",
+                          ("recorded " + ::std::to_string(m_recorder->records()) +
+                           " cycles to " + m_record_file),
+                          uvm::UVM_LOW);
         }
 
         phase.drop_objection(this);
@@ -260,7 +379,351 @@
         //--defer to parent class
         //--NB: reports pass/fail of the test
         base_t::report_phase(phase);
+
+        //--a fork server's child reports to its parent, too
+        auto &server{::fork_server::server_t::instance()};
+        if  (server.is_child())
+        {
+          using RC_t = ::utility::uvm_return_code_t;
+          auto const values  {test_bench().values_count()};
+          auto const controls{test_bench().controls_count()};
+          server.report(
+            {
+              static_cast<int>(is_pass() ? RC_t::success : RC_t::test_fail),
+              values.m_pass,
+              values.m_fail,
+              values.m_moot,
+              controls.m_pass,
+              controls.m_fail,
+              controls.m_moot,
+            });
+        }
+      }
+
+    private:   // types
+      using seq_item_t      = ::sequence_item::EXAMPLE::single_cycle_t;
+      using run_t           = void (single_cycle_t::*)(::std::size_t const);
+      using random_engine_t = ::request::base_t::random_engine_t;
+      using count_t         = ::score_board::counter::pass_fail_count_t;
+      using pairs_t         = ::score_board::counter::control_bit_pairs_t<
+                                ::score_board::EXAMPLE::single_cycle_t::control_bit_pairs_t::N_INPUT_CONTROL_BITS>;
+
+      using stimulus_image_t  = ::driver::EXAMPLE::single_cycle_t::stimulus_image_t;
+      using stimulus_writer_t = ::driver::EXAMPLE::single_cycle_t::stimulus_writer_t;
+
+      //--the sequences run after the resets; see: sequence(...)
+      static ::std::uint64_t constexpr sequence_count{6};
+
+      //--random_weighted_t's; coverage_adaptive_t's, when asked
+      //--NB: not all_control_pairs_t's; its directed sweep covers every
+      //      pair sooner than adapting can.  Thus, after it, there is
+      //      nothing left to adapt to; see: --sequence.
+      static ::std::uint64_t constexpr adaptive_position{1};
+
+      //--counts, as checkpointed
+      struct counts_t
+      {
+        unsigned fail;
+        unsigned moot;
+        unsigned pass;
+      };
+
+      //--one instance, as checkpointed
+      //--NB: plain data only; see: checkpoint.h
+      struct record_t
+      {
+        ::transaction::single_cycle_signals_t dut;       // see: sample_instance(...)
+        ::std::uint64_t                       random_seed;  // the sequencer's master seed
+        counts_t                              controls;  // score board counts
+        counts_t                              values;
+        unsigned                              pairs[pairs_t::N_BIT_COMBINATIONS]
+                                                   [pairs_t::N_BIT_COMBINATIONS];
+        unsigned                              pairs_prior_bits;
+        bool                                  pairs_prior_valid;
+      };
+
+      //--a checkpoint: the common generator, then the instances
+      using image_t = ::checkpoint::image_t<random_engine_t, record_t>;
+
+    private:   // methods
+      void run_instances(run_t const run)
+      { // run the given member on every instance, concurrently; join
+        auto &environment{test_bench().environment()};
+        ::sc_core::sc_join join{};
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, environment.instances()))
+          join.add_process(::sc_core::sc_spawn(sc_bind(run, this, ix)));
+        join.wait();
+      }
+
+      void checkpoint()
+      { // write a checkpoint of every instance, as asked.
+        // NB: between sequences only; the position is the number run.
+        if  (m_checkpoint_file.empty())
+          return;
+
+        auto &environment{test_bench().environment()};
+        m_records.assign(environment.instances(), record_t{});
+        run_instances(&single_cycle_t::sample_instance);
+
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, environment.instances()))
+        {
+          auto &record{m_records[ix]};
+          record.random_seed = environment.agent(ix).sequencer().random_seed();
+          record.controls = counts(test_bench().controls(ix).count());
+          record.values   = counts(test_bench().values(ix).count());
+
+          auto const &pairs{test_bench().pairs(ix).count()};
+          ::std::memcpy(record.pairs, pairs.check_array, sizeof(record.pairs));
+          record.pairs_prior_bits  = pairs.prior_bits;
+          record.pairs_prior_valid = pairs.prior_valid;
+        }
+
+        ::checkpoint::write(m_checkpoint_file,
+                            m_position,
+                            ::request::base_t::random_engine(),
+                            m_records);
+        uvm_report_info("CHECKPOINT",
+                        ("position: " + ::std::to_string(m_position)),
+                        uvm::UVM_LOW);
       }
+
+      void sample_instance(::std::size_t const ix)
+      { // sample the given instance at an edge, once its driver is quiescent.
+        // NB: as the monitor samples; the state before the edge, and the
+        //     stimuli clocked at it.  A restore clocks them again, thus the
+        //     checkpoint is taken after this edge's transaction is counted.
+        // NB: loosely timed, there is no edge; the state is that after the
+        //     last transport, and nothing is in flight.
+        auto &environment{test_bench().environment()};
+        auto &vif{environment.vif(ix)};
+# if  not defined(VIF_BACKEND_TLM)
+        do
+          ::sc_core::wait(vif.clock_posedge());
+        while  (not environment.agent(ix).driver().is_quiescent());
+# endif
+
+        auto &dut{m_records[ix].dut};
+        dut.state_0 =
+        {
+          {
+            vif.out.debug.is_advance.read(),
+            vif.out.ctl.is_error.read(),
+            vif.out.ctl.is_stall.read(),
+            vif.out.ctl.is_valid.read(),
+          },
+          {
+            vif.out.data.value.read(),
+          },
+          {
+            vif.out.debug.i_binary.read(),
+            vif.out.debug.i_number.read(),
+            vif.out.debug.is_advance.read(),
+          },
+        };
+        dut.stimuli =
+        {
+          {
+            vif.in.ctl.reset.read(),
+            vif.in.ctl.is_advance.read(),
+            vif.in.ctl.is_flush.read(),
+            vif.in.ctl.is_valid.read(),
+          },
+          {
+            vif.in.data.value.read(),
+          },
+          {
+            vif.in.debug.i_binary.read(),
+            vif.in.debug.i_number.read(),
+            vif.in.debug.is_error.read(),
+          },
+        };
+        dut.state_1 = dut.state_0;
+
+        //--the edge's transaction reaches the score boards first
+        ::sc_core::wait(::sc_core::SC_ZERO_TIME);
+      }
+
+      void restore(::std::string const &path)
+      { // continue from the given checkpoint.
+        // NB: the records are read in place, from the mapped file.
+        image_t const image{path};
+
+        auto &environment{test_bench().environment()};
+        if  (image.records() != environment.instances())
+          uvm_report_fatal("CHECKPOINT",
+                           ("Checkpoint " + path + " has " +
+                            ::std::to_string(image.records()) + " instances; this run has " +
+                            ::std::to_string(environment.instances()) + "."));
+
+        ::request::base_t::random_engine(image.common());
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, environment.instances()))
+        {
+          auto const &record{image.record(ix)};
+          environment.vif(ix).restore(record.dut);
+          environment.agent(ix).sequencer().random_seed(record.random_seed);
+          test_bench().controls(ix).count(count(record.controls));
+          test_bench().values(ix).count(count(record.values));
+
+          pairs_t pairs{};
+          ::std::memcpy(pairs.check_array, record.pairs, sizeof(record.pairs));
+          pairs.prior_bits  = record.pairs_prior_bits;
+          pairs.prior_valid = record.pairs_prior_valid;
+          test_bench().pairs(ix).count(pairs);
+        }
+
+        m_position    = image.position();
+        m_is_restored = true;
+        uvm_report_info("CHECKPOINT",
+                        ("restored " + path + " at position: " + ::std::to_string(m_position)),
+                        uvm::UVM_LOW);
+      }
+
+      static counts_t counts(count_t const &count)
+      { return  {count.m_fail, count.m_moot, count.m_pass}; }
+
+      static count_t count(counts_t const &counts)
+      {
+        count_t count{};
+        count.m_fail = counts.fail;
+        count.m_moot = counts.moot;
+        count.m_pass = counts.pass;
+        return  count;
+      }
+
+      void fork_point()
+      { // as a fork server: fork a child per seed, each its master seed;
+        // the parent never returns.
+        // NB: the children share the elaboration and the resets.
+        ::std::uint64_t seeds{0};
+        ::uvm::uvm_config_db<::std::uint64_t>::get(this, "", "fork_seeds", seeds);
+        if  (seeds == 0)
+          return;
+
+        ::std::uint64_t first_seed{::request::base_t::random_engine_t::default_seed};
+        ::uvm::uvm_config_db<::std::uint64_t>::get(this, "", "fork_first_seed", first_seed);
+
+        auto const seed{::fork_server::server_t::instance().serve(first_seed, seeds)};
+        uvm_report_info("FORK_SERVER", ("child seed: " + ::std::to_string(seed)));
+
+        auto &environment{test_bench().environment()};
+        ::request::base_t::random_seed(seed);
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, environment.instances()))
+          environment.agent(ix).sequencer().random_seed(seed);
+      }
+
+      void run_resets(::std::size_t const ix)
+      { // reset the given instance
+        ::std::vector<::sequence::base_t<seq_item_t>*> sequences
+        {
+          new ::sequence::repeat_t<seq_item_t>,
+          new ::sequence::repeat_t<seq_item_t, 1>{},
+          new ::sequence::repeat_t<seq_item_t>{5},
+        };
+
+        auto *const sequencer{&(test_bench().environment().agent(ix).sequencer())};
+        for (auto sequence: sequences)
+        {
+          uvm_report_info("SEQUENCE_START", sequence->get_name());
+          sequence->start(sequencer);
+        }
+      }
+
+      void run_playback(::std::size_t const ix)
+      { // play the recorded stimuli on the given instance
+        uvm_report_info("PLAYBACK",
+                        (m_playback_file + ": " + ::std::to_string(m_playback->records()) + " cycles"));
+        test_bench().environment().agent(ix).driver().play(*m_playback);
+      }
+
+      void run_sequence(::std::size_t const ix)
+      { // run the sequence at the current position on the given instance
+        // NB: its coroutine port, when asked and there is one; the driver
+        //     pulls its items in this thread, or its stimuli from a helper
+        //     thread's queue, when run ahead.
+        auto &agent{test_bench().environment().agent(ix)};
+        if  (m_is_adaptive and (m_position == adaptive_position))
+        { // NB: adapts to this instance's pair counts, live
+          auto *const sequence{new ::sequence::EXAMPLE::single_cycle_t::coverage_adaptive_t{}};
+          sequence->coverage(&(test_bench().pairs(ix).count().check_array));
+          uvm_report_info("SEQUENCE_START", sequence->get_name());
+          sequence->start(&(agent.sequencer()));
+          return;
+        }
+
+        if  (m_is_coroutine or m_is_ahead)
+        {
+          if  (::std::unique_ptr<::sequence::coroutine_t<seq_item_t>> const
+                 port{single_cycle_t::coroutine_sequence(m_position)}; port)
+          {
+            uvm_report_info("SEQUENCE_START", port->get_name());
+            if  (m_is_ahead)
+              port->start_ahead(agent.sequencer(), agent.driver());
+            else
+              port->start(agent.sequencer(), agent.driver());
+            return;
+          }
+        }
+
+        auto *const sequence{single_cycle_t::sequence(m_position)};
+        uvm_report_info("SEQUENCE_START", sequence->get_name());
+        sequence->start(&(agent.sequencer()));
+      }
+
+      void run_holes(::std::size_t const ix)
+      { // walk the given instance's pair coverage holes, if any
+        // NB: read live, as the walk starts; see: coverage.h
+        auto const &count{test_bench().pairs(ix).count()};
+        if  (count.is_coverage_complete())
+          return;
+
+        auto *const sequence{new ::sequence::EXAMPLE::single_cycle_t::coverage_holes_t{}};
+        sequence->coverage(&(count.check_array));
+        uvm_report_info("SEQUENCE_START", sequence->get_name());
+        sequence->start(&(test_bench().environment().agent(ix).sequencer()));
+      }
+
+      static ::sequence::base_t<seq_item_t> *sequence(::std::uint64_t const position)
+      { // the sequence run at the given position, after the resets
+        namespace seq_t = ::sequence::EXAMPLE::single_cycle_t;
+
+        switch  (position)
+        {
+          case  0:  return  new seq_t::all_control_pairs_t{};
+          case  1:  return  new seq_t::random_weighted_t{};
+          case  2:  return  new seq_t::random_loop_t{};
+          case  3:  return  new seq_t::flush_w_advance_never_advances_t{};
+          case  4:  return  new seq_t::error_w_advance_valid_t{};
+          default:  return  new seq_t::reset_advance_with_out_valid_t{};
+        }
+      }
+
+      static ::sequence::coroutine_t<seq_item_t> *coroutine_sequence(::std::uint64_t const position)
+      { // the coroutine port of the sequence at the given position, if any
+        namespace seq_t = ::sequence::EXAMPLE::single_cycle_t::coroutine;
+
+        switch  (position)
+        {
+          case  1:  return  new seq_t::random_weighted_t{};
+          case  2:  return  new seq_t::random_loop_t{};
+          default:  return  nullptr;
+        }
+      }
+
+    private:   // attributes
+      ::std::string           m_checkpoint_file;  // empty: no checkpoints
+      ::std::uint64_t         m_position;         // sequences run, after the resets
+      bool                    m_is_restored;      // true: continued from a checkpoint
+      bool                    m_is_alone;         // true: one sequence, m_alone
+      ::std::uint64_t         m_alone;            // its position
+      bool                    m_is_coroutine;     // true: run coroutine ports
+      bool                    m_is_ahead;         // true: run them ahead
+      bool                    m_is_adaptive;      // true: coverage_adaptive_t
+      bool                    m_is_closing;       // true: coverage_holes_t, last
+      ::std::string           m_record_file;      // empty: not recorded
+      ::std::string           m_playback_file;    // empty: not played back
+      ::std::unique_ptr<stimulus_writer_t> m_recorder;  // see: run_phase(...)
+      ::std::unique_ptr<stimulus_image_t>  m_playback;
+      ::std::vector<record_t> m_records;          // see: checkpoint()
   }; // class ::test::base_t
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
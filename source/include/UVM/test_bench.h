@@ -20,6 +20,10 @@
 //
 //  NOTES:
 //  2024-08-24: Moore, Peimann: created.
+//  2026-10-16: one set of score boards per replicated instance.
+//  2026-10-16: single_cycle_t sums its score boards' counts.
+//  2026-10-16: single_cycle_t gives access to each instance's score
+//              boards, for checkpoints.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,7 +32,9 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
-  // <none>
+# include <memory>
+# include <ranges>
+# include <vector>
 
   //--required library includes
   // <none>
@@ -38,6 +44,7 @@
 
 # include "environment.h"
 # include "score_board.h"
+# include "utility.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--forward declaratons
@@ -109,6 +116,8 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   // 
+  // NB: one set of score boards per replicated instance; the n-th set
+  //     listens to the environment's n-th monitor.
   
   class test_bench::EXAMPLE::single_cycle_t final
     : public ::test_bench::base_t<::environment::EXAMPLE::single_cycle_t>
@@ -127,16 +136,45 @@
       ~single_cycle_t() override
       { /* noOp */ }
 
+    public:    // types
+      using count_t = ::score_board::counter::pass_fail_count_t;
+
     public:    // accessors
       virtual bool is_pass() const override
       {
-        bool result{true};
-        result = (result and m_sb_controls and m_sb_controls->is_pass());
-        result = (result and m_sb_values and m_sb_values->is_pass());
-        result = (result and m_sb_pairs and m_sb_pairs->is_pass());
+        bool result{not m_sb_controls.empty()};
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, m_sb_controls.size()))
+        {
+          result = (result and m_sb_controls[ix] and m_sb_controls[ix]->is_pass());
+          result = (result and m_sb_values[ix] and m_sb_values[ix]->is_pass());
+          result = (result and m_sb_pairs[ix] and m_sb_pairs[ix]->is_pass());
+        }
         return  result;
       }
 
+      count_t controls_count() const
+      { // control bits counts, all instances
+        count_t count{};
+        for  (auto const &sb: m_sb_controls)
+          add(count, sb->count());
+        return  count;
+      }
+
+      count_t values_count() const
+      { // data values counts, all instances
+        count_t count{};
+        for  (auto const &sb: m_sb_values)
+          add(count, sb->count());
+        return  count;
+      }
+
+      auto &controls(::std::size_t const index)
+      { return  *m_sb_controls.at(index); }
+      auto &values(::std::size_t const index)
+      { return  *m_sb_values.at(index); }
+      auto &pairs(::std::size_t const index)
+      { return  *m_sb_pairs.at(index); }
+
     public:    // methods
       virtual void build_phase(::uvm::uvm_phase& phase) override
       {
@@ -150,12 +188,20 @@
         //--create the scoreboards
         //--theoretically can use multiple scoreboards,
         //  depending on what we want to measure
-        m_sb_controls.reset(
-          sb_controls_t::type_id::create("m_sb_controls", this));
-        m_sb_values.reset(
-          sb_values_t::type_id::create("m_sb_values", this));
-        m_sb_pairs.reset(
-          sb_pairs_t::type_id::create("m_sb_pairs", this));
+        //--NB: one set per replicated instance
+        unsigned instances{1};
+        ::uvm::uvm_config_db<unsigned>::get(this, "", "instances", instances);
+
+        using ::utility::format::indexed;
+        for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+        {
+          m_sb_controls.emplace_back(
+            sb_controls_t::type_id::create(indexed("m_sb_controls", ix), this));
+          m_sb_values.emplace_back(
+            sb_values_t::type_id::create(indexed("m_sb_values", ix), this));
+          m_sb_pairs.emplace_back(
+            sb_pairs_t::type_id::create(indexed("m_sb_pairs", ix), this));
+        }
       }
 
       void connect_phase(::uvm::uvm_phase& phase) override
@@ -164,12 +210,22 @@
         uvm_env::connect_phase(phase);
 
         //--connect score-board(s) to suitable monitors
-        m_sb_controls->connect_to(environment().monitor());
-        m_sb_values->connect_to(environment().monitor());
-        m_sb_pairs->connect_to(environment().monitor());
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, m_sb_controls.size()))
+        {
+          m_sb_controls[ix]->connect_to(environment().monitor(ix));
+          m_sb_values[ix]->connect_to(environment().monitor(ix));
+          m_sb_pairs[ix]->connect_to(environment().monitor(ix));
+        }
       }
 
     private:   // methods
+      static void add(count_t &sum, count_t const &count)
+      {
+        sum.m_fail = (sum.m_fail + count.m_fail);
+        sum.m_moot = (sum.m_moot + count.m_moot);
+        sum.m_pass = (sum.m_pass + count.m_pass);
+      }
+
     private:   // types
       using sb_controls_t = ::score_board::EXAMPLE::single_cycle_t::control_bits_t;
       using sb_controls_ptr = ::std::shared_ptr<sb_controls_t>;
@@ -181,9 +237,10 @@
       using sb_pairs_ptr = ::std::shared_ptr<sb_pairs_t>;
 
      private:   // attributes
-      sb_controls_ptr m_sb_controls;
-      sb_values_ptr   m_sb_values;
-      sb_pairs_ptr    m_sb_pairs;
+                // NB: one of each per instance
+      ::std::vector<sb_controls_ptr> m_sb_controls;
+      ::std::vector<sb_values_ptr>   m_sb_values;
+      ::std::vector<sb_pairs_ptr>    m_sb_pairs;
   };
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
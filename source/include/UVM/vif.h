@@ -20,6 +20,22 @@
 //
 //  NOTES:
 //  2024-07-10: Moore, Peimann: created.
+//  2026-10-16: added the native cycle-model backend; selected at build
+//              time by defining VIF_BACKEND_NATIVE.
+//  2026-10-16: the signal backend accepts any clock source.
+//  2026-10-16: added time warp; can_warp(), warp(...), and warped().
+//  2026-10-16: the signal backend carries packed control buses when
+//              MODEL_CONTROL_PACKED is defined; the native backend has
+//              no channels to pack.
+//  2026-10-16: no debug string channels when MODEL_NO_DEBUG_STRING is
+//              defined; see: model::debug_string_t.
+//  2026-10-16: added the loosely-timed TLM-2.0 backend; selected at build
+//              time by defining VIF_BACKEND_TLM.
+//  2026-10-16: added the bit-sliced bank backend; each vif is one lane of
+//              a shared bank, selected at build time by defining
+//              VIF_BACKEND_BANK.
+//  2026-10-16: every backend can be restored from a checkpoint before the
+//              simulation starts, see: restore(...), checkpoint.h.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--invocation guard
@@ -28,13 +44,22 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
+# include <cstddef>
+# include <cstdint>
+# include <functional>
 # include <string>
+# include <vector>
 
   //--required library includes
   // <none>
 
   //--required project includes
+# include "TLM.h"
+# include "clocking.h"
 # include "model.h"
+# include "transaction.h"
+# include "EXAMPLE/single_cycle_bank.h"
+# include "EXAMPLE/single_cycle_model.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--declaratons
@@ -44,10 +69,45 @@
     //--base class for all VIFs.
     class base_t;
 
+    namespace native
+    { // support for native (non-SystemC) backends.
+      //--two-phase value holder; stands in for a signal.
+      template<typename VALUE_T>
+      class signal_t;
+    } // namespace ::vif::native
+
     namespace EXAMPLE
     { // virtual interfaces for various example modules which were developed.
-      //--complete interface to the ::EXAMPLE::single_cycle_t module.
-      class single_cycle_t;
+      //--complete pin-level interface to the ::EXAMPLE::single_cycle_t
+      //--module; SystemC signals throughout, used for signoff.
+      class single_cycle_signal_t;
+
+      //--complete interface to the ::EXAMPLE::single_cycle_model_t cycle
+      //--model; steps the model directly, no signals in the loop.
+      class single_cycle_native_t;
+
+      //--loosely-timed interface to the ::EXAMPLE::single_cycle_tlm_t
+      //--target; one blocking transport per cycle, no clock edges.
+      class single_cycle_tlm_t;
+
+      //--the ::EXAMPLE::single_cycle_bank_t bit-sliced cycle model; one
+      //--evaluation clocks all of its lanes.
+      class single_cycle_bank_t;
+
+      //--complete interface to one lane of a single_cycle_bank_t.
+      class single_cycle_lane_t;
+
+      //--the interface used by drivers and monitors.
+      //--NB: selected at build time.
+# if  defined(VIF_BACKEND_TLM)
+      using single_cycle_t = single_cycle_tlm_t;
+# elif  defined(VIF_BACKEND_BANK)
+      using single_cycle_t = single_cycle_lane_t;
+# elif  defined(VIF_BACKEND_NATIVE)
+      using single_cycle_t = single_cycle_native_t;
+# else
+      using single_cycle_t = single_cycle_signal_t;
+# endif
     } // namespace ::vif::EXAMPLE
   } // namespace ::vif
 
@@ -67,48 +127,106 @@
   };
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
-  //--class ::vif::EXAMPLE::single_cycle_t
+  //--class ::vif::EXAMPLE::single_cycle_signal_t
 
-  class vif::EXAMPLE::single_cycle_t final
+  class vif::EXAMPLE::single_cycle_signal_t final
     : public ::vif::base_t
   {
     public:   // forward declarations
+      using model_t    = ::EXAMPLE::single_cycle_model_t;
+      using payload_t  = ::transaction::single_cycle_signals_t;
+      using restorer_t = ::std::function<void(model_t::state_t const &)>;
+
     public:   // c'tors and d'tor
-      single_cycle_t(
-        SC::module_name              name,
-        model::signal::clock_t      &system_clock,
-        model::signal::is_advance_t &ctl_is_advance,
-        model::signal::is_error_t   &ctl_is_error,
-        model::signal::is_stall_t   &ctl_is_stall,
-        model::signal::is_valid_t   &ctl_is_valid,
-        model::signal::value_t      &data_value,
-        model::signal::i_binary_t   &dbg_i_binary,
-        model::signal::i_number_t   &dbg_i_number,
-        model::signal::is_advance_t &dbg_is_advance,
-        SC::signal<std::string>     &dbg_string)
+      single_cycle_signal_t(
+        SC::module_name                name,
+        model::signal::clock_if_t     &system_clock,
+# if  defined(MODEL_CONTROL_PACKED)
+        model::signal::control_out_t  &ctl_bus,
+# else
+        model::signal::is_advance_t   &ctl_is_advance,
+        model::signal::is_error_t     &ctl_is_error,
+        model::signal::is_stall_t     &ctl_is_stall,
+        model::signal::is_valid_t     &ctl_is_valid,
+# endif
+        model::signal::value_t        &data_value,
+        model::signal::i_binary_t     &dbg_i_binary,
+        model::signal::i_number_t     &dbg_i_number,
+# if  defined(MODEL_NO_DEBUG_STRING)
+        model::signal::is_advance_t   &dbg_is_advance)
+# else
+        model::signal::is_advance_t   &dbg_is_advance,
+        model::signal::debug_string_t &dbg_string)
+# endif
         : base_t{name}
         , in{{system_clock}, {}, {}, {}}
+# if  defined(MODEL_CONTROL_PACKED)
+        , out{{ctl_bus},
+# else
         , out{{ctl_is_advance, ctl_is_error, ctl_is_stall, ctl_is_valid},
+# endif
               {data_value}, 
+# if  defined(MODEL_NO_DEBUG_STRING)
+              {dbg_i_binary, dbg_i_number, dbg_is_advance}}
+# else
               {dbg_i_binary, dbg_i_number, dbg_is_advance, dbg_string}}
+# endif
+        , m_warp_clock{dynamic_cast<::clocking::cycle_clock_t *>(&system_clock)}
+        , m_restorer{}
       { /* noOp */ }
 
+      single_cycle_signal_t(single_cycle_signal_t const &) = delete;
+      single_cycle_signal_t &operator=(single_cycle_signal_t const &) = delete;
+
     public:   // accessors
+      bool can_warp() const
+      { // time warp needs a clock which can elide edges
+        return  (m_warp_clock != nullptr);
+      }
+
+      ::std::uint64_t warped() const
+      { // edges elided immediately before the latest edge
+        return  (can_warp() ? m_warp_clock->warped() : 0);
+      }
+
     public:   // methods
       SC::event const &clock_posedge() const
       {
         return  in.clock.clock.posedge_event();
       }
 
+      void warp(::std::uint64_t const cycles)
+      { // elide the next given number of clock edges.
+        // NB: the caller guarantees the DUT/MUT state is stable.
+        if  (not can_warp())
+          SC::REPORT_FATAL("The clock cannot warp.", __FILE__, __LINE__);
+        m_warp_clock->warp(cycles);
+      }
+
+      void restore_with(restorer_t const &restorer)
+      { // restore the DUT/MUT state with the given restorer.
+        // NB: one restorer; the DUT/MUT's own, see: restore(...).
+        m_restorer = restorer;
+      }
+
+      void restore(payload_t const &signals);  // NB: deferred; see: single_cycle_native_t
+
       void set_control_inputs(model::reset_t const      reset,
                               model::is_advance_t const is_advance,
                               model::is_flush_t const   is_flush,
                               model::is_valid_t const   is_valid)
       {
+# if  defined(MODEL_CONTROL_PACKED)
+        in.ctl.bus.write(model::control_in_t::pack(reset,
+                                                   is_advance,
+                                                   is_flush,
+                                                   is_valid));
+# else
         in.ctl.reset.write(reset);
         in.ctl.is_advance.write(is_advance);
         in.ctl.is_flush.write(is_flush);
         in.ctl.is_valid.write(is_valid);
+# endif
       }
 
       void set_data_inputs(model::value_t const value)
@@ -116,15 +234,17 @@
         in.data.value.write(value);
       }
 
-      void set_debug_inputs(model::i_binary_t const i_binary,
-                            model::i_number_t const i_number,
-                            model::is_error_t const is_error,
-                            std::string const      &string)
+      void set_debug_inputs(model::i_binary_t const      i_binary,
+                            model::i_number_t const      i_number,
+                            model::is_error_t const      is_error,
+                            model::debug_string_t const &string [[maybe_unused]])
       {
         in.debug.i_binary.write(i_binary);
         in.debug.i_number.write(i_number);
         in.debug.is_error.write(is_error);
+# if  not defined(MODEL_NO_DEBUG_STRING)
         in.debug.string.write(string);
+# endif
       }
 
       void trace_to_file(SC::trace_file *const tf)
@@ -135,6 +255,10 @@
         //SC::trace(tf, in.clock.clock.get_interface(), "vif.in.clock.clock");
 
         //--control signals
+# if  defined(MODEL_CONTROL_PACKED)
+        SC::trace(tf, in.ctl.bus,         "vif.in.ctl.bus");
+        SC::trace(tf, out.ctl.bus,        "vif.out.ctl.bus");
+# else
         SC::trace(tf, in.ctl.reset,       "vif.in.ctl.reset");
         SC::trace(tf, in.ctl.is_advance,  "vif.in.ctl.is_advance");
         SC::trace(tf, in.ctl.is_flush,    "vif.in.ctl.is_flush");
@@ -143,6 +267,7 @@
         SC::trace(tf, out.ctl.is_error,   "vif.out.ctl.is_error");
         SC::trace(tf, out.ctl.is_stall,   "vif.out.ctl.is_stall");
         SC::trace(tf, out.ctl.is_valid,   "vif.out.ctl.is_valid");
+# endif
 
         //--data signals
         SC::trace(tf, in.data.value,  "vif.in.data.value");
@@ -152,11 +277,13 @@
         SC::trace(tf, in.debug.i_binary,    "vif.in.debug.i_binary");
         SC::trace(tf, in.debug.i_number,    "vif.in.debug.i_number");
         SC::trace(tf, in.debug.is_error,    "vif.in.debug.is_error");
-        SC::trace(tf, in.debug.string,      "vif.in.debug.string");
         SC::trace(tf, out.debug.i_binary,   "vif.out.debug.i_binary");
         SC::trace(tf, out.debug.i_number,   "vif.out.debug.i_number");
         SC::trace(tf, out.debug.is_advance, "vif.out.debug.is_advance");
+# if  not defined(MODEL_NO_DEBUG_STRING)
+        SC::trace(tf, in.debug.string,      "vif.in.debug.string");
         SC::trace(tf, out.debug.string,     "vif.out.debug.string");
+# endif
 
         //--end of compilation unit with implicit return
       }
@@ -168,7 +295,7 @@
         struct clock_t
         { // system clocking channel
           // NB: the clock is inherited from the test setup
-          model::signal::clock_t &clock;
+          model::signal::clock_if_t &clock;
         };
 
         struct control_t
@@ -176,10 +303,19 @@
           // NB: these signals are common to all pipeline stages.
           // NB: prefetch stage may have additional signals.
           // NB: prefetch stage sees "is_flush" as "branch".
+# if  defined(MODEL_CONTROL_PACKED)
+          // NB: packed; the fields read as the signals they replace.
+          model::signal::control_in_t      bus       {"ctl_bus"};
+          model::control::in::reset_t      reset     {bus};
+          model::control::in::is_advance_t is_advance{bus};
+          model::control::in::is_flush_t   is_flush  {bus};
+          model::control::in::is_valid_t   is_valid  {bus};
+# else
           model::signal::reset_t      reset     {"ctl_reset"     };
           model::signal::is_advance_t is_advance{"ctl_is_advance"};
           model::signal::is_flush_t   is_flush  {"ctl_is_flush"  };
           model::signal::is_valid_t   is_valid  {"ctl_is_valid"  };
+# endif
         };
 
         struct data_t
@@ -191,10 +327,12 @@
         struct debug_t
         { // debug channel
           // NB: we may want to create a common debug in the model
-          model::signal::i_binary_t i_binary{"dbg_i_binary"};
-          model::signal::i_number_t i_number{"dbg_i_number"};
-          model::signal::is_error_t is_error{"dbg_is_error"};
-          SC::signal<::std::string> string  {"dbg_string"};
+          model::signal::i_binary_t     i_binary{"dbg_i_binary"};
+          model::signal::i_number_t     i_number{"dbg_i_number"};
+          model::signal::is_error_t     is_error{"dbg_is_error"};
+# if  not defined(MODEL_NO_DEBUG_STRING)
+          model::signal::debug_string_t string{"dbg_string"};
+# endif
         };
 
         clock_t   clock;
@@ -212,10 +350,19 @@
           //     signal for each functional unit below it.
           // NB: functional units will have an output "is_flush"
           //     signal.
+# if  defined(MODEL_CONTROL_PACKED)
+          // NB: packed; the fields read as the signals they replace.
+          ::sc_core::sc_signal_in_if<model::control_out_t> &bus;
+          model::control::out::is_advance_t is_advance{bus};
+          model::control::out::is_error_t   is_error  {bus};
+          model::control::out::is_stall_t   is_stall  {bus};
+          model::control::out::is_valid_t   is_valid  {bus};
+# else
           ::sc_core::sc_signal_in_if<model::is_advance_t> &is_advance;
           ::sc_core::sc_signal_in_if<model::is_error_t>   &is_error;
           ::sc_core::sc_signal_in_if<model::is_stall_t>   &is_stall;
           ::sc_core::sc_signal_in_if<model::is_valid_t>   &is_valid;
+# endif
         };
 
         struct data_t
@@ -226,10 +373,12 @@
 
         struct debug_t
         { // debug channel
-          ::sc_core::sc_signal_in_if<model::i_binary_t>   &i_binary;
-          ::sc_core::sc_signal_in_if<model::i_number_t>   &i_number;
-          ::sc_core::sc_signal_in_if<model::is_advance_t> &is_advance;
-          ::sc_core::sc_signal_in_if<::std::string>       &string;
+          ::sc_core::sc_signal_in_if<model::i_binary_t>     &i_binary;
+          ::sc_core::sc_signal_in_if<model::i_number_t>     &i_number;
+          ::sc_core::sc_signal_in_if<model::is_advance_t>   &is_advance;
+# if  not defined(MODEL_NO_DEBUG_STRING)
+          ::sc_core::sc_signal_in_if<model::debug_string_t> &string;
+# endif
         };
 
         control_t ctl;
@@ -244,10 +393,928 @@
 
     private:   // methods
     private:   // local types and declarations
-      using SC_CURRENT_USER_MODULE = ::vif::EXAMPLE::single_cycle_t;
+      using SC_CURRENT_USER_MODULE = ::vif::EXAMPLE::single_cycle_signal_t;
+    private:   // attributes
+      ::clocking::cycle_clock_t *m_warp_clock;  // null: cannot warp
+      restorer_t                 m_restorer;    // the DUT/MUT's; see: restore(...)
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::vif::native::signal_t<VALUE_T>
+  //--two-phase value holder for native backends.
+  //--NB: read() returns the current value, write() sets the next value.
+  //--NB: the owning backend calls update() at the clock edge, which stands
+  //--    in for the SystemC update phase; readers never see a torn cycle.
+
+  template<typename VALUE_T>
+  class vif::native::signal_t final
+  {
+    public:   // published types
+      using value_t = VALUE_T;
+
+    public:   // c'tors and d'tor
+      signal_t()
+        : m_current{}
+        , m_next{}
+      { /* noOp */ }
+
+    public:   // accessors
+      value_t const &read() const
+      { return  m_current; }
+
+    public:   // methods
+      void update()
+      { m_current = m_next; }
+
+      void write(value_t const &value)
+      { m_next = value; }
+
+    private:  // attributes
+      value_t m_current;  // value seen by readers
+      value_t m_next;     // value seen after the next update()
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::vif::EXAMPLE::single_cycle_native_t
+  //--NB: presents the same members and methods as single_cycle_signal_t,
+  //--    thus drivers and monitors compile unchanged against either.
+  //--NB: the clock is an internal method process re-triggered once per
+  //--    period; there is no clock, no signal, and no module instance.
+  //--NB: inputs written during a cycle are latched at the next clock edge,
+  //--    and the state clocked at an edge is published at the following
+  //--    edge.  This matches what the monitor samples on the pin-level
+  //--    interface.
+
+  class vif::EXAMPLE::single_cycle_native_t final
+    : public ::vif::base_t
+  {
+    public:   // forward declarations
+      using model_t   = ::EXAMPLE::single_cycle_model_t;
+      using payload_t = ::transaction::single_cycle_signals_t;
+
+    public:   // c'tors and d'tor
+      single_cycle_native_t(
+        SC::module_name name,
+        SC::time const &clock_period)
+        : base_t{name}
+        , in{}
+        , out{}
+        , m_clock_period{clock_period}
+        , m_posedge{"posedge"}
+        , m_state{}
+        , m_warp{0}
+        , m_eliding{0}
+        , m_warped{0}
+      {
+        SC_METHOD(clock_edge);
+      }
+
+    public:   // accessors
+      bool can_warp() const
+      { return  true; }
+
+      ::std::uint64_t warped() const
+      { // edges elided immediately before the latest edge
+        return  m_warped;
+      }
+
+    public:   // methods
+      SC::event const &clock_posedge() const
+      {
+        return  m_posedge;
+      }
+
+      void warp(::std::uint64_t const cycles)
+      { // elide the next given number of clock edges.
+        // NB: the caller guarantees the model state is stable.
+        m_warp = cycles;
+      }
+
+      void restore(payload_t const &signals)
+      { // restore the model to state_0, and drive the stimuli; the first
+        // edge clocks them.
+        // NB: before the simulation starts; see: checkpoint.h.
+        m_state = state(signals.state_0);
+
+        auto const &stimuli{signals.stimuli};
+        set_control_inputs(stimuli.ctl.reset,
+                           stimuli.ctl.is_advance,
+                           stimuli.ctl.is_flush,
+                           stimuli.ctl.is_valid);
+        set_data_inputs(stimuli.data.value);
+        set_debug_inputs(stimuli.debug.i_binary,
+                         stimuli.debug.i_number,
+                         stimuli.debug.is_error,
+                         {});
+      }
+
+      static model_t::state_t state(payload_t::mut_output_state_t const &output)
+      { // the model state for the given outputs, as the monitor samples
+        // them; NB: the debug string is empty.
+        return
+        {
+          output.debug.is_advance,
+          output.ctl.is_error,
+          output.ctl.is_stall,
+          output.ctl.is_valid,
+          output.data.value,
+          output.debug.i_binary,
+          output.debug.i_number,
+          {},
+        };
+      }
+
+      void set_control_inputs(model::reset_t const      reset,
+                              model::is_advance_t const is_advance,
+                              model::is_flush_t const   is_flush,
+                              model::is_valid_t const   is_valid)
+      {
+        in.ctl.reset.write(reset);
+        in.ctl.is_advance.write(is_advance);
+        in.ctl.is_flush.write(is_flush);
+        in.ctl.is_valid.write(is_valid);
+      }
+
+      void set_data_inputs(model::value_t const value)
+      {
+        in.data.value.write(value);
+      }
+
+      void set_debug_inputs(model::i_binary_t const      i_binary,
+                            model::i_number_t const      i_number,
+                            model::is_error_t const      is_error,
+                            model::debug_string_t const &string)
+      {
+        in.debug.i_binary.write(i_binary);
+        in.debug.i_number.write(i_number);
+        in.debug.is_error.write(is_error);
+        in.debug.string.write(string);
+      }
+
+      void trace_to_file(SC::trace_file *const tf)
+      { // start tracing values
+        // NB: traces the current (read) side of each value.
+        // NB: debug strings are not traced.
+
+        //--control values
+        SC::trace(tf, in.ctl.reset.read(),       "vif.in.ctl.reset");
+        SC::trace(tf, in.ctl.is_advance.read(),  "vif.in.ctl.is_advance");
+        SC::trace(tf, in.ctl.is_flush.read(),    "vif.in.ctl.is_flush");
+        SC::trace(tf, in.ctl.is_valid.read(),    "vif.in.ctl.is_valid");
+        SC::trace(tf, out.ctl.is_advance.read(), "vif.out.ctl.is_advance");
+        SC::trace(tf, out.ctl.is_error.read(),   "vif.out.ctl.is_error");
+        SC::trace(tf, out.ctl.is_stall.read(),   "vif.out.ctl.is_stall");
+        SC::trace(tf, out.ctl.is_valid.read(),   "vif.out.ctl.is_valid");
+
+        //--data values
+        SC::trace(tf, in.data.value.read(),  "vif.in.data.value");
+        SC::trace(tf, out.data.value.read(), "vif.out.data.value");
+
+        //--debug values
+        SC::trace(tf, in.debug.i_binary.read(),    "vif.in.debug.i_binary");
+        SC::trace(tf, in.debug.i_number.read(),    "vif.in.debug.i_number");
+        SC::trace(tf, in.debug.is_error.read(),    "vif.in.debug.is_error");
+        SC::trace(tf, out.debug.i_binary.read(),   "vif.out.debug.i_binary");
+        SC::trace(tf, out.debug.i_number.read(),   "vif.out.debug.i_number");
+        SC::trace(tf, out.debug.is_advance.read(), "vif.out.debug.is_advance");
+
+        //--end of compilation unit with implicit return
+      }
+
+    public:   // convenience classes
+              // NB: these group values into structured bundles
+      template<typename VALUE_T>
+      using signal_t = ::vif::native::signal_t<VALUE_T>;
+
+      struct mut_input_t
+      { // inputs to the cycle model
+        struct control_t
+        { // control channel
+          signal_t<model::reset_t>      reset;
+          signal_t<model::is_advance_t> is_advance;
+          signal_t<model::is_flush_t>   is_flush;
+          signal_t<model::is_valid_t>   is_valid;
+        };
+
+        struct data_t
+        { // data channel
+          signal_t<model::value_t> value;
+        };
+
+        struct debug_t
+        { // debug channel
+          signal_t<model::i_binary_t> i_binary;
+          signal_t<model::i_number_t> i_number;
+          signal_t<model::is_error_t> is_error;
+          signal_t<model::debug_string_t> string;
+        };
+
+        control_t ctl;
+        data_t    data;
+        debug_t   debug;
+      };
+
+      struct mut_output_t
+      { // outputs from the cycle model
+        struct control_t
+        { // control channel
+          signal_t<model::is_advance_t> is_advance;
+          signal_t<model::is_error_t>   is_error;
+          signal_t<model::is_stall_t>   is_stall;
+          signal_t<model::is_valid_t>   is_valid;
+        };
+
+        struct data_t
+        { // data channel
+          signal_t<model::value_t> value;
+        };
+
+        struct debug_t
+        { // debug channel
+          signal_t<model::i_binary_t>   i_binary;
+          signal_t<model::i_number_t>   i_number;
+          signal_t<model::is_advance_t> is_advance;
+          signal_t<model::debug_string_t> string;
+        };
+
+        control_t ctl;
+        data_t    data;
+        debug_t   debug;
+      };
+
+    public:    // attributes
+               // NB: these must follow their structure declarations
+      mut_input_t   in;    // inputs to the cycle model
+      mut_output_t  out;   // outputs from the cycle model
+
+    private:   // methods
+      void clock_edge()
+      { // one active clock edge; re-triggers itself once per period.
+        // NB: a pending warp elides edges; sleep over them instead.
+        if  (m_warp == 0)
+          clock_model();
+        else
+          elide_edges();
+      }
+
+      void elide_edges()
+      { // sleep over the requested edges in one step
+        m_eliding = m_warp;
+        m_warp    = 0;
+        next_trigger(m_clock_period * static_cast<double>(m_eliding));
+      }
+
+      void clock_model()
+      { // clock the model, then sleep for one period.
+        m_warped  = m_eliding;
+        m_eliding = 0;
+
+        //--latch the inputs driven since the prior edge
+        latch_inputs();
+
+        //--publish the state clocked at the prior edge
+        publish_state();
+
+        //--clock the model with the latched inputs
+        model_t::input_t const input
+        {
+          in.ctl.reset.read(),
+          in.ctl.is_advance.read(),
+          in.ctl.is_flush.read(),
+          in.ctl.is_valid.read(),
+          in.data.value.read(),
+          in.debug.i_binary.read(),
+          in.debug.i_number.read(),
+          in.debug.is_error.read(),
+          in.debug.string.read(),
+        };
+
+        m_state.is_advance = model_t::advance(m_state.is_stall,
+                                              m_state.is_valid,
+                                              input.is_advance);
+        model_t::cycle(input, m_state);
+
+        //--wake the driver and monitor, then sleep for one period
+        m_posedge.notify();
+        next_trigger(m_clock_period);
+
+        //--end of compilation unit with implicit return
+      }
+
+      void latch_inputs()
+      { // the "update phase" for the inputs
+        in.ctl.reset.update();
+        in.ctl.is_advance.update();
+        in.ctl.is_flush.update();
+        in.ctl.is_valid.update();
+        in.data.value.update();
+        in.debug.i_binary.update();
+        in.debug.i_number.update();
+        in.debug.is_error.update();
+        in.debug.string.update();
+      }
+
+      void publish_state()
+      { // the "update phase" for the outputs
+        // NB: ctl.is_advance is combinational; computed from the newly
+        //     published state and the newly latched inputs.
+        out.ctl.is_advance.write(model_t::advance(m_state.is_stall,
+                                                  m_state.is_valid,
+                                                  in.ctl.is_advance.read()));
+        out.ctl.is_error.write(m_state.is_error);
+        out.ctl.is_stall.write(m_state.is_stall);
+        out.ctl.is_valid.write(m_state.is_valid);
+        out.data.value.write(m_state.value);
+        out.debug.i_binary.write(m_state.i_binary);
+        out.debug.i_number.write(m_state.i_number);
+        out.debug.is_advance.write(m_state.is_advance);
+        out.debug.string.write(m_state.string);
+
+        out.ctl.is_advance.update();
+        out.ctl.is_error.update();
+        out.ctl.is_stall.update();
+        out.ctl.is_valid.update();
+        out.data.value.update();
+        out.debug.i_binary.update();
+        out.debug.i_number.update();
+        out.debug.is_advance.update();
+        out.debug.string.update();
+      }
+
+    private:   // local types and declarations
+      using SC_CURRENT_USER_MODULE = ::vif::EXAMPLE::single_cycle_native_t;
+
     private:   // attributes
+      SC::time         m_clock_period;  // time between active edges
+      SC::event        m_posedge;       // the active clock edge
+      model_t::state_t m_state;         // state clocked at the last edge
+      ::std::uint64_t  m_warp;          // edges to elide; requested
+      ::std::uint64_t  m_eliding;       // edges to elide; in progress
+      ::std::uint64_t  m_warped;        // edges elided before latest edge
   };
 
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::vif::EXAMPLE::single_cycle_tlm_t
+  //--NB: presents the same members and methods as single_cycle_signal_t,
+  //--    thus drivers and monitors compile unchanged against either; the
+  //--    clock edge is never notified, a cycle is a call to transport().
+  //--NB: inputs written since the last transport are the stimuli of the
+  //--    next; the outputs read as the state after the last transport.
+  //--NB: loosely timed; the caller runs ahead of the kernel by up to one
+  //--    global quantum, then syncs, see: TLM::set_global_quantum(...).
+  //--    Thousands of cycles pass per kernel context switch.
+  //--NB: each transported payload is a complete transaction; it is handed
+  //--    straight to the observer, see: observe(...).
+
+  class vif::EXAMPLE::single_cycle_tlm_t final
+    : public ::vif::base_t
+  {
+    public:   // forward declarations
+      using model_t    = ::EXAMPLE::single_cycle_model_t;
+      using payload_t  = ::transaction::single_cycle_signals_t;
+      using observer_t = ::std::function<void(payload_t const &)>;
+      using restorer_t = ::std::function<void(model_t::state_t const &)>;
+
+    public:   // c'tors and d'tor
+      single_cycle_tlm_t(SC::module_name name)
+        : base_t{name}
+        , socket{"socket"}
+        , in{}
+        , out{}
+        , m_posedge{"posedge"}
+        , m_keeper{}
+        , m_payload{}
+        , m_signals{}
+        , m_observer{}
+        , m_restorer{}
+      {
+        m_keeper.reset();
+        m_payload.set_command(TLM::write_command);
+        m_payload.set_address(0);
+        m_payload.set_data_ptr(static_cast<unsigned char *>(
+                                 static_cast<void *>(&m_signals)));
+        m_payload.set_data_length(sizeof(m_signals));
+        m_payload.set_streaming_width(sizeof(m_signals));
+        m_payload.set_byte_enable_ptr(nullptr);
+        m_payload.set_dmi_allowed(false);
+      }
+
+      single_cycle_tlm_t(single_cycle_tlm_t const &) = delete;
+      single_cycle_tlm_t &operator=(single_cycle_tlm_t const &) = delete;
+
+    public:   // accessors
+      bool can_warp() const
+      { return  false; }
+
+      ::std::uint64_t warped() const
+      { return  0; }
+
+    public:   // methods
+      SC::event const &clock_posedge() const
+      { // NB: never notified; see: transport()
+        return  m_posedge;
+      }
+
+      void warp(::std::uint64_t const)
+      {
+        SC::REPORT_FATAL("The TLM backend cannot warp.", __FILE__, __LINE__);
+      }
+
+      void observe(observer_t const &observer)
+      { // hand each transported payload to the given observer.
+        // NB: one observer; the monitor.
+        m_observer = observer;
+      }
+
+      void restore_with(restorer_t const &restorer)
+      { // restore the target state with the given restorer.
+        // NB: one restorer; the target's own, see: restore(...).
+        m_restorer = restorer;
+      }
+
+      void restore(payload_t const &signals)
+      { // restore the target to state_0.
+        // NB: before the simulation starts; see: checkpoint.h.
+        // NB: nothing is in flight between transports; the stimuli are
+        //     moot, the next transport carries the driver's own.
+        if  (not m_restorer)
+          SC::REPORT_FATAL("The TLM target cannot be restored.", __FILE__, __LINE__);
+        m_restorer(single_cycle_native_t::state(signals.state_0));
+
+        m_signals.state_1 = signals.state_0;
+        publish_state();
+      }
+
+      void transport()
+      { // one cycle: latch the inputs, transport them, publish the state.
+        // NB: syncs with the kernel only once the quantum is used up.
+        latch_inputs();
+        m_signals.stimuli =
+        {
+          {
+            in.ctl.reset.read(),
+            in.ctl.is_advance.read(),
+            in.ctl.is_flush.read(),
+            in.ctl.is_valid.read(),
+          },
+          {
+            in.data.value.read(),
+          },
+          {
+            in.debug.i_binary.read(),
+            in.debug.i_number.read(),
+            in.debug.is_error.read(),
+          },
+        };
+
+        auto delay{m_keeper.get_local_time()};
+        m_payload.set_response_status(TLM::incomplete_response);
+        socket->b_transport(m_payload, delay);
+        if  (m_payload.is_response_error())
+          SC::REPORT_FATAL(m_payload.get_response_string().c_str(),
+                           __FILE__,
+                           __LINE__);
+        m_keeper.set(delay);
+
+        publish_state();
+        if  (m_observer)
+          m_observer(m_signals);
+
+        if  (m_keeper.need_sync())
+          m_keeper.sync();
+      }
+
+      void set_control_inputs(model::reset_t const      reset,
+                              model::is_advance_t const is_advance,
+                              model::is_flush_t const   is_flush,
+                              model::is_valid_t const   is_valid)
+      {
+        in.ctl.reset.write(reset);
+        in.ctl.is_advance.write(is_advance);
+        in.ctl.is_flush.write(is_flush);
+        in.ctl.is_valid.write(is_valid);
+      }
+
+      void set_data_inputs(model::value_t const value)
+      {
+        in.data.value.write(value);
+      }
+
+      void set_debug_inputs(model::i_binary_t const      i_binary,
+                            model::i_number_t const      i_number,
+                            model::is_error_t const      is_error,
+                            model::debug_string_t const &string)
+      {
+        in.debug.i_binary.write(i_binary);
+        in.debug.i_number.write(i_number);
+        in.debug.is_error.write(is_error);
+        in.debug.string.write(string);
+      }
+
+      void trace_to_file(SC::trace_file *const)
+      { // NB: nothing is traced; values change between kernel syncs, so
+        //     a trace would not show them at their cycle times.
+      }
+
+    public:   // convenience classes
+              // NB: as per the native backend
+      using mut_input_t  = single_cycle_native_t::mut_input_t;
+      using mut_output_t = single_cycle_native_t::mut_output_t;
+
+    public:    // attributes
+               // NB: these must follow their structure declarations
+      TLM::initiator_socket<single_cycle_tlm_t> socket;  // to the target
+      mut_input_t   in;    // inputs to the target
+      mut_output_t  out;   // outputs from the target
+
+    private:   // methods
+      void latch_inputs()
+      { // the "update phase" for the inputs
+        in.ctl.reset.update();
+        in.ctl.is_advance.update();
+        in.ctl.is_flush.update();
+        in.ctl.is_valid.update();
+        in.data.value.update();
+        in.debug.i_binary.update();
+        in.debug.i_number.update();
+        in.debug.is_error.update();
+        in.debug.string.update();
+      }
+
+      void publish_state()
+      { // the "update phase" for the outputs
+        auto const &state{m_signals.state_1};
+        out.ctl.is_advance.write(state.ctl.is_advance);
+        out.ctl.is_error.write(state.ctl.is_error);
+        out.ctl.is_stall.write(state.ctl.is_stall);
+        out.ctl.is_valid.write(state.ctl.is_valid);
+        out.data.value.write(state.data.value);
+        out.debug.i_binary.write(state.debug.i_binary);
+        out.debug.i_number.write(state.debug.i_number);
+        out.debug.is_advance.write(state.debug.is_advance);
+
+        out.ctl.is_advance.update();
+        out.ctl.is_error.update();
+        out.ctl.is_stall.update();
+        out.ctl.is_valid.update();
+        out.data.value.update();
+        out.debug.i_binary.update();
+        out.debug.i_number.update();
+        out.debug.is_advance.update();
+      }
+
+    private:   // attributes
+      SC::event            m_posedge;   // never notified
+      TLM::quantum_keeper  m_keeper;    // local time ahead of the kernel
+      TLM::generic_payload m_payload;   // points at m_signals
+      payload_t            m_signals;   // the transaction in flight
+      observer_t           m_observer;  // receives each transported payload
+      restorer_t           m_restorer;  // the target's; see: restore(...)
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::vif::EXAMPLE::single_cycle_bank_t
+  //--NB: the clock is an internal method process re-triggered once per
+  //--    period, as per the native backend; each edge latches the inputs
+  //--    of every lane, clocks the bank once, and hands each lane its
+  //--    state and its transaction.
+  //--NB: lanes attach themselves in construction order, up to the width
+  //--    of the bank; see: single_cycle_lane_t.
+
+  class vif::EXAMPLE::single_cycle_bank_t final
+    : public ::vif::base_t
+  {
+    public:   // forward declarations
+      using bank_t = ::EXAMPLE::single_cycle_bank_t;
+
+    public:   // c'tors and d'tor
+      single_cycle_bank_t(
+        SC::module_name name,
+        SC::time const &clock_period)
+        : base_t{name}
+        , m_clock_period{clock_period}
+        , m_posedge{"posedge"}
+        , m_lanes{}
+        , m_input{}
+        , m_state{}
+      {
+        m_lanes.reserve(bank_t::lanes);
+        SC_METHOD(clock_edge);
+      }
+
+      single_cycle_bank_t(single_cycle_bank_t const &) = delete;
+      single_cycle_bank_t &operator=(single_cycle_bank_t const &) = delete;
+
+    public:   // accessors
+      ::std::size_t lanes() const
+      { // lanes attached, thus clocked
+        return  m_lanes.size();
+      }
+
+    public:   // methods
+      SC::event const &clock_posedge() const
+      {
+        return  m_posedge;
+      }
+
+      ::std::size_t attach(single_cycle_lane_t *const lane)
+      { // attach the given lane; returns its lane number.
+        if  (m_lanes.size() == bank_t::lanes)
+          SC::REPORT_FATAL("The bank has no free lane.", __FILE__, __LINE__);
+        m_lanes.push_back(lane);
+        return  (m_lanes.size() - 1);
+      }
+
+      void restore(::std::size_t const                             lane,
+                   ::EXAMPLE::single_cycle_model_t::state_t const &state)
+      { // restore the given lane's state
+        // NB: before the simulation starts; see: single_cycle_lane_t.
+        bank_t::lane(m_state, lane, state);
+      }
+
+    private:   // methods
+      void clock_edge();  // NB: deferred; see: single_cycle_lane_t
+
+    private:   // local types and declarations
+      using SC_CURRENT_USER_MODULE = ::vif::EXAMPLE::single_cycle_bank_t;
+
+    private:   // attributes
+      SC::time                            m_clock_period;  // time between active edges
+      SC::event                           m_posedge;       // the active clock edge
+      ::std::vector<single_cycle_lane_t*> m_lanes;         // attached; NB: not owned
+      bank_t::input_t                     m_input;         // inputs latched at the last edge
+      bank_t::state_t                     m_state;         // state clocked at the last edge
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::vif::EXAMPLE::single_cycle_lane_t
+  //--NB: presents the same members and methods as single_cycle_signal_t,
+  //--    thus drivers and monitors compile unchanged against either.
+  //--NB: inputs written during a cycle are latched at the next clock edge,
+  //--    and the state clocked at an edge is published at the following
+  //--    edge; as per the native backend.
+  //--NB: each clocked cycle is a complete transaction; it is handed
+  //--    straight to the observer, see: observe(...).
+  //--NB: lanes share the clock; none can warp.
+
+  class vif::EXAMPLE::single_cycle_lane_t final
+    : public ::vif::base_t
+  {
+    public:   // forward declarations
+      using model_t    = ::EXAMPLE::single_cycle_model_t;
+      using payload_t  = ::transaction::single_cycle_signals_t;
+      using observer_t = ::std::function<void(payload_t const &)>;
+
+    public:   // c'tors and d'tor
+      single_cycle_lane_t(
+        SC::module_name      name,
+        single_cycle_bank_t &bank)
+        : base_t{name}
+        , in{}
+        , out{}
+        , m_bank{bank}
+        , m_lane{bank.attach(this)}
+        , m_signals{}
+        , m_observer{}
+      { /* noOp */ }
+
+      single_cycle_lane_t(single_cycle_lane_t const &) = delete;
+      single_cycle_lane_t &operator=(single_cycle_lane_t const &) = delete;
+
+    public:   // accessors
+      bool can_warp() const
+      { return  false; }
+
+      ::std::uint64_t warped() const
+      { return  0; }
+
+      ::std::size_t lane() const
+      { return  m_lane; }
+
+    public:   // methods
+      SC::event const &clock_posedge() const
+      {
+        return  m_bank.clock_posedge();
+      }
+
+      void warp(::std::uint64_t const)
+      {
+        SC::REPORT_FATAL("A bank lane cannot warp.", __FILE__, __LINE__);
+      }
+
+      void observe(observer_t const &observer)
+      { // hand each clocked transaction to the given observer.
+        // NB: one observer; the monitor.
+        m_observer = observer;
+      }
+
+      void restore(payload_t const &signals)
+      { // restore the lane to state_0, and drive the stimuli; the first
+        // edge clocks them.
+        // NB: before the simulation starts; see: checkpoint.h.
+        m_bank.restore(m_lane, single_cycle_native_t::state(signals.state_0));
+
+        auto const &stimuli{signals.stimuli};
+        set_control_inputs(stimuli.ctl.reset,
+                           stimuli.ctl.is_advance,
+                           stimuli.ctl.is_flush,
+                           stimuli.ctl.is_valid);
+        set_data_inputs(stimuli.data.value);
+        set_debug_inputs(stimuli.debug.i_binary,
+                         stimuli.debug.i_number,
+                         stimuli.debug.is_error,
+                         {});
+      }
+
+      void set_control_inputs(model::reset_t const      reset,
+                              model::is_advance_t const is_advance,
+                              model::is_flush_t const   is_flush,
+                              model::is_valid_t const   is_valid)
+      {
+        in.ctl.reset.write(reset);
+        in.ctl.is_advance.write(is_advance);
+        in.ctl.is_flush.write(is_flush);
+        in.ctl.is_valid.write(is_valid);
+      }
+
+      void set_data_inputs(model::value_t const value)
+      {
+        in.data.value.write(value);
+      }
+
+      void set_debug_inputs(model::i_binary_t const      i_binary,
+                            model::i_number_t const      i_number,
+                            model::is_error_t const      is_error,
+                            model::debug_string_t const &string)
+      {
+        in.debug.i_binary.write(i_binary);
+        in.debug.i_number.write(i_number);
+        in.debug.is_error.write(is_error);
+        in.debug.string.write(string);
+      }
+
+      void trace_to_file(SC::trace_file *const)
+      { // NB: nothing is traced; the lanes are evaluated together, inside
+        //     the bank, and have no values of their own to trace.
+      }
+
+    public:   // methods; NB: for the bank only
+      model_t::input_t latch_inputs()
+      { // the "update phase" for the inputs; returns them.
+        in.ctl.reset.update();
+        in.ctl.is_advance.update();
+        in.ctl.is_flush.update();
+        in.ctl.is_valid.update();
+        in.data.value.update();
+        in.debug.i_binary.update();
+        in.debug.i_number.update();
+        in.debug.is_error.update();
+        in.debug.string.update();
+
+        return
+        {
+          in.ctl.reset.read(),
+          in.ctl.is_advance.read(),
+          in.ctl.is_flush.read(),
+          in.ctl.is_valid.read(),
+          in.data.value.read(),
+          in.debug.i_binary.read(),
+          in.debug.i_number.read(),
+          in.debug.is_error.read(),
+          in.debug.string.read(),
+        };
+      }
+
+      void publish(model_t::state_t const &state_0,
+                   model_t::state_t const &state_1)
+      { // publish the state before this edge, and hand on the transaction
+        // from that state to the state after it.
+        publish_state(state_0);
+
+        m_signals.stimuli =
+        {
+          {
+            in.ctl.reset.read(),
+            in.ctl.is_advance.read(),
+            in.ctl.is_flush.read(),
+            in.ctl.is_valid.read(),
+          },
+          {
+            in.data.value.read(),
+          },
+          {
+            in.debug.i_binary.read(),
+            in.debug.i_number.read(),
+            in.debug.is_error.read(),
+          },
+        };
+        m_signals.state_0 = output(state_0);
+        m_signals.state_1 = output(state_1);
+        if  (m_observer)
+          m_observer(m_signals);
+      }
+
+    public:   // convenience classes
+              // NB: as per the native backend
+      using mut_input_t  = single_cycle_native_t::mut_input_t;
+      using mut_output_t = single_cycle_native_t::mut_output_t;
+
+    public:    // attributes
+               // NB: these must follow their structure declarations
+      mut_input_t   in;    // inputs to the lane
+      mut_output_t  out;   // outputs from the lane
+
+    private:   // methods
+      void publish_state(model_t::state_t const &state)
+      { // the "update phase" for the outputs
+        // NB: ctl.is_advance is combinational; as per the native backend.
+        out.ctl.is_advance.write(model_t::advance(state.is_stall,
+                                                  state.is_valid,
+                                                  in.ctl.is_advance.read()));
+        out.ctl.is_error.write(state.is_error);
+        out.ctl.is_stall.write(state.is_stall);
+        out.ctl.is_valid.write(state.is_valid);
+        out.data.value.write(state.value);
+        out.debug.i_binary.write(state.i_binary);
+        out.debug.i_number.write(state.i_number);
+        out.debug.is_advance.write(state.is_advance);
+
+        out.ctl.is_advance.update();
+        out.ctl.is_error.update();
+        out.ctl.is_stall.update();
+        out.ctl.is_valid.update();
+        out.data.value.update();
+        out.debug.i_binary.update();
+        out.debug.i_number.update();
+        out.debug.is_advance.update();
+      }
+
+      static payload_t::mut_output_state_t output(model_t::state_t const &state)
+      { // the lane outputs for the given state, as the monitor samples
+        // them; see: ::EXAMPLE::single_cycle_tlm_t::output(...)
+        return
+        {
+          {state.is_advance, state.is_error, state.is_stall, state.is_valid},
+          {state.value},
+          {state.i_binary, state.i_number, state.is_advance},
+        };
+      }
+
+    private:   // attributes
+      single_cycle_bank_t &m_bank;      // clocks this lane
+      ::std::size_t        m_lane;      // lane number within the bank
+      payload_t            m_signals;   // the transaction last clocked
+      observer_t           m_observer;  // receives each clocked transaction
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred definitions
+
+  inline void vif::EXAMPLE::single_cycle_signal_t::restore(payload_t const &signals)
+  { // restore the DUT/MUT to state_0, and drive the stimuli; the first
+    // edge clocks them.
+    // NB: before the simulation starts; see: checkpoint.h.
+    if  (not m_restorer)
+      SC::REPORT_FATAL("The DUT/MUT cannot be restored.", __FILE__, __LINE__);
+    m_restorer(single_cycle_native_t::state(signals.state_0));
+
+    auto const &stimuli{signals.stimuli};
+    set_control_inputs(stimuli.ctl.reset,
+                       stimuli.ctl.is_advance,
+                       stimuli.ctl.is_flush,
+                       stimuli.ctl.is_valid);
+    set_data_inputs(stimuli.data.value);
+    set_debug_inputs(stimuli.debug.i_binary,
+                     stimuli.debug.i_number,
+                     stimuli.debug.is_error,
+                     {});
+  }
+
+  inline void vif::EXAMPLE::single_cycle_bank_t::clock_edge()
+  { // one active clock edge; re-triggers itself once per period.
+    //--latch the inputs driven since the prior edge, lane by lane
+    for  (::std::size_t ix{0}; ix < m_lanes.size(); ++ix)
+      bank_t::lane(m_input, ix, m_lanes[ix]->latch_inputs());
+
+    //--clock every lane at once with the latched inputs
+    bank_t::state_t const state_0{m_state};
+    m_state.is_advance = bank_t::advance(m_state.is_stall,
+                                         m_state.is_valid,
+                                         m_input.is_advance);
+    bank_t::cycle(m_input, m_state);
+
+    //--publish each lane's state, and hand on its transaction
+    for  (::std::size_t ix{0}; ix < m_lanes.size(); ++ix)
+      m_lanes[ix]->publish(bank_t::lane(state_0, ix),
+                           bank_t::lane(m_state, ix));
+
+    //--wake the drivers, then sleep for one period
+    m_posedge.notify();
+    next_trigger(m_clock_period);
+
+    //--end of compilation unit with implicit return
+  }
+
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //--end of invocation guard
 #endif // not defined(__VIF_H__)
@@ -0,0 +1,198 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  checkpoint.h
+//  - checkpoint files: the state needed to continue a run, written at a
+//    point where it is complete, and mapped back in to restore it.
+//
+//  Design Decisions:
+//  - a file is a header, one COMMON_T, then one RECORD_T per replicated
+//    instance; each is plain data, written raw, and read in place from a
+//    read-only mapping, see: mmap(2).  There is no parsing on restore.
+//  - raw means the layout of the build that wrote it; the header records
+//    the sizes of COMMON_T and RECORD_T, and a file that does not match
+//    the reading build is refused, not misread.
+//  - a file is written whole, to a temporary, then renamed over the old
+//    one; a run that dies while writing leaves the prior checkpoint.  See:
+//    raw_file.h.
+//  - what a record holds, and when it is complete, is up to the test; see:
+//    test.h.
+//
+//  NOTES:
+//  2026-10-16: created.
+//  2026-10-16: mapping and temporaries moved to raw_file.h.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__CHECKPOINT_H__)
+# define __CHECKPOINT_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <string>
+# include <type_traits>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "raw_file.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace checkpoint
+  {
+    //--the start of every checkpoint file
+    struct header_t;
+
+    //--a checkpoint file, mapped in for reading
+    template<class COMMON_T, class RECORD_T>
+    class image_t;
+
+    //--write a checkpoint file
+    template<class COMMON_T, class RECORD_T>
+    void write(::std::string const            &path,
+               ::std::uint64_t const           position,
+               COMMON_T const                 &common,
+               ::std::vector<RECORD_T> const  &records);
+
+    //--the header's identification
+    char constexpr            magic[8]{'C', 'H', 'E', 'C', 'K', 'P', 'T', '\0'};
+    ::std::uint32_t constexpr version{1};
+  } // namespace checkpoint
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+
+  struct checkpoint::header_t final
+  { // NB: plain data only; see: Design Decisions
+    char            magic[8];     // see: ::checkpoint::magic
+    ::std::uint32_t version;      // see: ::checkpoint::version
+    ::std::uint32_t common_size;  // sizeof(COMMON_T) of the writer
+    ::std::uint64_t record_size;  // sizeof(RECORD_T) of the writer
+    ::std::uint64_t records;      // one per replicated instance
+    ::std::uint64_t position;     // where the run stood; test defined
+  };
+
+  static_assert(::std::is_trivially_copyable_v<::checkpoint::header_t>);
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  template<class COMMON_T, class RECORD_T>
+  class checkpoint::image_t final
+  {
+    public:   // published types
+      using common_t = COMMON_T;
+      using record_t = RECORD_T;
+
+      static_assert(::std::is_trivially_copyable_v<common_t>);
+      static_assert(::std::is_trivially_copyable_v<record_t>);
+
+    public:   // c'tors and d'tor
+      image_t(::std::string const &path)
+        : m_file{path, "checkpoint", sizeof(header_t)}
+      { // map in the given file, and check it matches this build
+        auto const &found{header()};
+        m_file.require(::raw_file::is_identified(found, ::checkpoint::magic, ::checkpoint::version) and
+                       (found.common_size == sizeof(common_t)) and
+                       (found.record_size == sizeof(record_t)) and
+                       (m_file.size() == size(found.records)));
+      }
+
+      image_t(image_t const &) = delete;
+      image_t &operator=(image_t const &) = delete;
+
+    public:   // accessors
+      header_t const &header() const
+      { return  *static_cast<header_t const *>(m_file.base()); }
+
+      ::std::uint64_t position() const
+      { return  header().position; }
+
+      ::std::size_t records() const
+      { return  static_cast<::std::size_t>(header().records); }
+
+      common_t const &common() const
+      { return  *static_cast<common_t const *>(m_file.at(common_offset())); }
+
+      record_t const &record(::std::size_t const index) const
+      { // NB: in place; no copy is made
+        return  *static_cast<record_t const *>(
+                  m_file.at(record_offset() + (index * sizeof(record_t))));
+      }
+
+    public:   // methods
+      static ::std::size_t common_offset()
+      { return  aligned(sizeof(header_t), alignof(common_t)); }
+
+      static ::std::size_t record_offset()
+      { return  aligned((common_offset() + sizeof(common_t)), alignof(record_t)); }
+
+      static ::std::size_t size(::std::uint64_t const records)
+      { // of a file holding the given number of records
+        return  (record_offset() + (static_cast<::std::size_t>(records) * sizeof(record_t)));
+      }
+
+    private:  // methods
+      static ::std::size_t aligned(::std::size_t const offset,
+                                   ::std::size_t const alignment)
+      { return  (((offset + alignment) - 1) / alignment) * alignment; }
+
+    private:  // attributes
+      ::raw_file::mapping_t m_file;
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  template<class COMMON_T, class RECORD_T>
+  void checkpoint::write(::std::string const            &path,
+                         ::std::uint64_t const           position,
+                         COMMON_T const                 &common,
+                         ::std::vector<RECORD_T> const  &records)
+  { // write the file whole, to a temporary, then rename it into place.
+    using image_t = ::checkpoint::image_t<COMMON_T, RECORD_T>;
+
+    header_t header{{}, ::checkpoint::version, sizeof(COMMON_T), sizeof(RECORD_T), records.size(), position};
+    ::std::memcpy(header.magic, ::checkpoint::magic, sizeof(header.magic));
+
+    //--the file image; NB: padding is zeroed
+    ::std::vector<char> buffer(image_t::size(records.size()), '\0');
+    ::std::memcpy(buffer.data(), &header, sizeof(header));
+    ::std::memcpy((buffer.data() + image_t::common_offset()), &common, sizeof(common));
+    if  (not records.empty())
+      ::std::memcpy((buffer.data() + image_t::record_offset()),
+                    records.data(),
+                    (records.size() * sizeof(RECORD_T)));
+
+    ::raw_file::temporary_t file{path, "checkpoint"};
+    file.write(buffer.data(), buffer.size());
+    file.publish();
+  }
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__CHECKPOINT_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
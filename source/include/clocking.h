@@ -0,0 +1,194 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  clocking.h
+//  - clock sources other than the free-running SystemC clock.
+//
+//  Design Decisions:
+//  - every process in the design is sensitive to the active (positive)
+//    edge only; an sc_clock nonetheless schedules both edges, updates its
+//    signal twice, and notifies three events per cycle.
+//  - cycle_clock_t produces the active edge only: one timed trigger and
+//    one event notification per cycle, time advances in whole periods.
+//  - cycle_clock_t implements the boolean signal input interface so it
+//    binds to the same ports, and sensitivity to pos(), as an sc_clock.
+//  - cycle_clock_t can elide a run of edges on request (time warp); time
+//    jumps over the elided edges in one timed trigger, and the next edge
+//    reports how many were elided, see: warp(...) and warped().
+//
+//  NOTES:
+//  2026-10-16: created; added class clocking::cycle_clock_t.
+//  2026-10-16: added time warp; cycle_clock_t::warp(...) &c.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__CLOCKING_H__)
+# define __CLOCKING_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <cstdint>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+# include "model.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace clocking
+  { // clock sources
+    //--active-edge only, cycle-stepped clock.
+    class cycle_clock_t;
+  } // namespace ::clocking
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::clocking::cycle_clock_t
+  //--NB: read() is always true; there is no inactive phase to observe.
+  //--NB: value_changed_event(), posedge_event(), and default_event() are
+  //--    all the active edge; negedge_event() is never notified.
+  //--NB: the edge is an immediate notification from a method process, so
+  //--    sensitive processes run in the same evaluation phase, as they do
+  //--    on the delta following an sc_clock's posedge update.
+
+  class clocking::cycle_clock_t final
+    : public ::SC::module
+    , public ::model::signal::clock_if_t
+  {
+    public:   // c'tors and d'tor
+      cycle_clock_t(SC::module_name name, SC::time const &period)
+        : SC::module{name}
+        , m_period{period}
+        , m_posedge{"posedge"}
+        , m_negedge{"negedge"}
+        , m_value{true}
+        , m_edge_delta{compl ::std::uint64_t{0}}
+        , m_edge_count{0}
+        , m_warp{0}
+        , m_eliding{0}
+        , m_warped{0}
+      {
+        SC_METHOD(edge);
+      }
+
+    public:   // accessors
+      SC::time const &period() const
+      { return  m_period; }
+
+      ::std::uint64_t edge_count() const
+      { // active edges, including elided edges
+        return  m_edge_count;
+      }
+
+      ::std::uint64_t warped() const
+      { // edges elided immediately before the latest edge
+        return  m_warped;
+      }
+
+    public:   // methods
+      void warp(::std::uint64_t const cycles)
+      { // elide the next given number of edges.
+        // NB: the caller guarantees nothing observable happens on them.
+        m_warp = cycles;
+      }
+
+    public:   // methods (sc_interface)
+      SC::event const &default_event() const override
+      { return  m_posedge; }
+
+    public:   // methods (sc_signal_in_if<bool>)
+      SC::event const &value_changed_event() const override
+      { return  m_posedge; }
+
+      SC::event const &posedge_event() const override
+      { return  m_posedge; }
+
+      SC::event const &negedge_event() const override
+      { return  m_negedge; }
+
+      bool const &read() const override
+      { return  m_value; }
+
+      bool const &get_data_ref() const override
+      { return  m_value; }
+
+      bool event() const override
+      { return  (m_edge_delta == SC::delta_count()); }
+
+      bool posedge() const override
+      { return  event(); }
+
+      bool negedge() const override
+      { return  false; }
+
+    private:  // methods
+      void edge()
+      { // one active edge, then sleep for one period.
+        // NB: a pending warp elides edges; sleep over them instead.
+        if  (m_warp == 0)
+        {
+          m_warped     = m_eliding;
+          m_eliding    = 0;
+          m_edge_delta = SC::delta_count();
+          m_edge_count = (m_edge_count + 1);
+          m_posedge.notify();
+          next_trigger(m_period);
+        }
+        else
+        {
+          m_eliding    = m_warp;
+          m_warp       = 0;
+          m_edge_count = (m_edge_count + m_eliding);
+          next_trigger(m_period * static_cast<double>(m_eliding));
+        }
+      }
+
+    private:  // local types and declarations
+      using SC_CURRENT_USER_MODULE = ::clocking::cycle_clock_t;
+
+    private:  // attributes
+      SC::time        m_period;      // time between active edges
+      SC::event       m_posedge;     // the active edge
+      SC::event       m_negedge;     // never notified
+      bool            m_value;       // always "high"
+      ::std::uint64_t m_edge_delta;  // delta count of the latest edge
+      ::std::uint64_t m_edge_count;  // edges since start of simulation
+      ::std::uint64_t m_warp;        // edges to elide; requested
+      ::std::uint64_t m_eliding;     // edges to elide; in progress
+      ::std::uint64_t m_warped;      // edges elided before latest edge
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace clocking
+  {
+    // <none>
+  } // namespace ::clocking
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__CLOCKING_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,234 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  coroutine.h
+//  - C++20 coroutine support; a generator that yields by reference.
+//
+//  Design Decisions:
+//  - ::std::generator is C++23; generator_t<T> is the least of it that
+//    sequences need: co_yield an lvalue, the consumer pulls with next()
+//    and reads, or modifies, the yielded object in place with value().
+//  - the yielded object lives in the coroutine frame; it is valid until
+//    the next call to next().  Nothing is copied.
+//  - the coroutine starts suspended, runs only when pulled, and may not
+//    co_await; an exception escaping it is rethrown from next().
+//  - a generator owns its frame; it is movable, not copyable.
+//  - a coroutine may mark its last item, co_yield last(item); the consumer
+//    then knows, by is_last(), that the next next() finishes it, before it
+//    calls it.  E.g. so that the coroutine's locals are destroyed on the
+//    thread that owns them; see: sequence.h producer_t.
+//
+//  NOTES:
+//  2026-10-16: created; added coroutine::generator_t.
+//  2026-10-16: added coroutine::last(...) and generator_t<T>::is_last().
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__COROUTINE_H__)
+# define __COROUTINE_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <coroutine>
+# include <exception>
+# include <memory>
+# include <utility>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+  // <none>
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace coroutine
+  { // C++20 coroutine support
+    //--a coroutine that yields T lvalues, pulled one at a time.
+    template<class T>
+    class generator_t;
+
+    //--the last item a coroutine yields, marked; see: last(...)
+    template<class T>
+    struct last_t;
+
+    //--marks the given item as the last; co_yield last(item)
+    template<class T>
+    last_t<T> last(T &value);
+  } // namespace ::coroutine
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--struct ::coroutine::last_t<T>
+
+  template<class T>
+  struct coroutine::last_t final
+  {
+    T &value;
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::coroutine::generator_t<T>
+  //--NB: e.g.
+  //--      generator_t<item_t> items() { item_t item{}; co_yield item; }
+  //--      for  (auto items{items()}; items.next();)
+  //--        use(items.value());
+
+  template<class T>
+  class coroutine::generator_t final
+  {
+    public:   // published types
+      class promise_type final
+      { // the coroutine's side; required by name
+        public:   // c'tors and d'tor
+          promise_type()
+            : m_value{nullptr}
+            , m_is_last{false}
+            , m_exception{}
+          { /* noOp */ }
+
+          promise_type(promise_type const &) = delete;
+          promise_type &operator=(promise_type const &) = delete;
+
+        public:   // methods
+          generator_t get_return_object()
+          { return  generator_t{handle_t::from_promise(*this)}; }
+
+          ::std::suspend_always initial_suspend() noexcept
+          { return  {}; }
+
+          ::std::suspend_always final_suspend() noexcept
+          { return  {}; }
+
+          ::std::suspend_always yield_value(T &value) noexcept
+          { // NB: the object stays in the frame; see: value()
+            m_value   = ::std::addressof(value);
+            m_is_last = false;
+            return  {};
+          }
+
+          ::std::suspend_always yield_value(last_t<T> const last) noexcept
+          { // NB: as above; and nothing follows it, see: is_last()
+            m_value   = ::std::addressof(last.value);
+            m_is_last = true;
+            return  {};
+          }
+
+          void return_void()
+          { /* noOp */ }
+
+          void unhandled_exception()
+          { m_exception = ::std::current_exception(); }
+
+          //--no co_await in a generator
+          template<class U>
+          ::std::suspend_never await_transform(U &&) = delete;
+
+        public:   // attributes
+          T                   *m_value;      // the last yielded
+          bool                 m_is_last;    // true: yielded by last(...)
+          ::std::exception_ptr m_exception;  // escaped the coroutine
+      };
+
+    private:  // local types
+      using handle_t = ::std::coroutine_handle<promise_type>;
+
+    public:   // c'tors and d'tor
+      generator_t(generator_t &&other) noexcept
+        : m_handle{::std::exchange(other.m_handle, nullptr)}
+      { /* noOp */ }
+
+      generator_t &operator=(generator_t &&other) noexcept
+      {
+        if  (this != &other)
+        {
+          destroy();
+          m_handle = ::std::exchange(other.m_handle, nullptr);
+        }
+        return  *this;
+      }
+
+      generator_t(generator_t const &) = delete;
+      generator_t &operator=(generator_t const &) = delete;
+
+      ~generator_t()
+      { destroy(); }
+
+    public:   // accessors
+      T &value() const
+      { // the object last yielded; NB: valid until next()
+        return  *(m_handle.promise().m_value);
+      }
+
+      bool is_last() const
+      { // true: value() is marked the last; the next next() finishes
+        return  m_handle and m_handle.promise().m_is_last;
+      }
+
+    public:   // methods
+      bool next()
+      { // run to the next co_yield; false once the coroutine returns.
+        if  ((not m_handle) or m_handle.done())
+          return  false;
+
+        m_handle.resume();
+        if  (m_handle.promise().m_exception)
+          ::std::rethrow_exception(::std::exchange(m_handle.promise().m_exception, nullptr));
+        return  not m_handle.done();
+      }
+
+    private:  // c'tors and d'tor
+      explicit generator_t(handle_t const handle)
+        : m_handle{handle}
+      { /* noOp */ }
+
+    private:  // methods
+      void destroy()
+      {
+        if  (m_handle)
+          m_handle.destroy();
+        m_handle = nullptr;
+      }
+
+    private:  // attributes
+      handle_t m_handle;  // owned
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::coroutine::last<T>(value)
+
+  template<class T>
+  coroutine::last_t<T> coroutine::last(T &value)
+  { return  last_t<T>{value}; }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace coroutine
+  {
+    // <none>
+  } // namespace ::coroutine
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__COROUTINE_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
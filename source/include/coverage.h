@@ -0,0 +1,278 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  coverage.h
+//  - coverage closure; directed stimuli for the pairs a run did not cover.
+//
+//  Design Decisions:
+//  - a pair count is as the control_bit_pairs_t score board keeps it:
+//    counts[prior][next], over N combinations of the control inputs.  A
+//    hole is a pair counted zero.
+//  - the control inputs are free; any combination may follow any other,
+//    in any state of the DUT/MUT.  The model searched is thus the complete
+//    graph of combinations, and the holes are its edges to be walked.
+//  - hole_walk(...) is the shortest walk that takes every hole, or within
+//    a cycle of it: each weakly connected set of holes is balanced with
+//    filler edges, deficit to surplus, walked as one Euler circuit
+//    (Hierholzer), and cut at the fillers into trails.  The trails are
+//    chained; a trail not starting where the last ended costs one cycle.
+//    The walk is |holes| + (trails - 1) cycles, plus one to reach the
+//    first trail, unless it starts at the prior.
+//  - pure; no UVM, no SystemC, no random numbers.  The same counts give
+//    the same walk.
+//
+//  NOTES:
+//  2026-10-16: created; added coverage::holes(...) and
+//              coverage::hole_walk(...).
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__COVERAGE_H__)
+# define __COVERAGE_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <algorithm>
+# include <array>
+# include <cstddef>
+# include <numeric>
+# include <ranges>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+  // <none>
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace coverage
+  { // coverage closure
+    //--the pair counts of N combinations, [prior][next]
+    template<::std::size_t N>
+    using counts_t = unsigned[N][N];
+
+    //--the number of pairs not yet observed
+    template<::std::size_t N>
+    ::std::size_t holes(counts_t<N> const &counts);
+
+    //--the combinations to drive, after the prior, that take every pair
+    //--not yet observed; empty when there are none.
+    template<::std::size_t N>
+    ::std::vector<::std::size_t> hole_walk(counts_t<N> const &counts,
+                                           ::std::size_t const prior);
+  } // namespace ::coverage
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::coverage::holes<N>(counts)
+
+  template<::std::size_t N>
+  ::std::size_t coverage::holes(counts_t<N> const &counts)
+  {
+    ::std::size_t result{0};
+    for  (auto const &row: counts)
+      for  (auto const count: row)
+        result = (result + ((count == 0) ? 1 : 0));
+    return  result;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::coverage::hole_walk<N>(counts, prior)
+  //--NB: see: Design Decisions.
+
+  template<::std::size_t N>
+  ::std::vector<::std::size_t> coverage::hole_walk(counts_t<N> const &counts,
+                                                   ::std::size_t const prior)
+  {
+    using ::std::ranges::views::iota;
+
+    //--the edges: the holes, then the fillers
+    struct edge_t
+    {
+      ::std::size_t from;
+      ::std::size_t to;
+      bool          is_filler;
+    };
+    ::std::vector<edge_t> edges{};
+    for  (auto const from: iota(::std::size_t{0}, N))
+      for  (auto const to: iota(::std::size_t{0}, N))
+        if  (counts[from][to] == 0)
+          edges.push_back(edge_t{from, to, false});
+    if  (edges.empty())
+      return  {};
+
+    //--weakly connected sets of holes; NB: union-find, by the lesser root
+    ::std::array<::std::size_t, N> root{};
+    ::std::iota(root.begin(), root.end(), ::std::size_t{0});
+    auto const find{[&root](::std::size_t v)
+    {
+      while  (root[v] != v)
+        v = root[v] = root[root[v]];
+      return  v;
+    }};
+    for  (auto const &edge: edges)
+    {
+      auto const a{find(edge.from)};
+      auto const b{find(edge.to)};
+      root[::std::max(a, b)] = ::std::min(a, b);
+    }
+
+    //--balance each set: a filler from each deficit to a surplus
+    ::std::array<long, N> balance{};  // out - in
+    for  (auto const &edge: edges)
+    {
+      balance[edge.from] = (balance[edge.from] + 1);
+      balance[edge.to]   = (balance[edge.to] - 1);
+    }
+    for  (auto const set: iota(::std::size_t{0}, N))
+    {
+      ::std::vector<::std::size_t> deficit{};
+      ::std::vector<::std::size_t> surplus{};
+      for  (auto const v: iota(::std::size_t{0}, N))
+      {
+        if  (find(v) != set)
+          continue;
+        for  (long ix{0}; ix < -balance[v]; ++ix)
+          deficit.push_back(v);
+        for  (long ix{0}; ix < balance[v]; ++ix)
+          surplus.push_back(v);
+      }
+      for  (auto const ix: iota(::std::size_t{0}, deficit.size()))
+        edges.push_back(edge_t{deficit[ix], surplus[ix], true});
+    }
+
+    //--the trails: each set's Euler circuit, cut at its fillers
+    //--NB: a set with no fillers is one closed trail
+    ::std::vector<::std::vector<edge_t const *>> out(N);
+    for  (auto const &edge: edges)
+      out[edge.from].push_back(&edge);
+
+    struct trail_t
+    {
+      ::std::vector<::std::size_t> vertices;  // NB: closed: first == last
+      bool                         is_closed;
+    };
+    ::std::vector<trail_t> trails{};
+    ::std::array<::std::size_t, N> next{};   // the next unused edge out
+    for  (auto const set: iota(::std::size_t{0}, N))
+    {
+      if  ((find(set) != set) or out[set].empty())
+        continue;
+
+      //--Hierholzer; the circuit's edges, in reverse
+      ::std::vector<edge_t const *> circuit{};
+      ::std::vector<edge_t const *> path{};
+      ::std::size_t at{set};
+      for  (;;)
+      {
+        if  (next[at] < out[at].size())
+        {
+          auto const *const edge{out[at][next[at]]};
+          next[at] = (next[at] + 1);
+          path.push_back(edge);
+          at = edge->to;
+        }
+        else if  (not path.empty())
+        {
+          circuit.push_back(path.back());
+          at = path.back()->from;
+          path.pop_back();
+        }
+        else
+          break;
+      }
+      ::std::ranges::reverse(circuit);
+
+      //--start after a filler, if any, and cut at each
+      auto const filler{::std::ranges::find_if(circuit, [](auto const *const edge)
+                                               { return  edge->is_filler; })};
+      bool const is_closed{filler == circuit.end()};
+      if  (not is_closed)
+        ::std::rotate(circuit.begin(), (filler + 1), circuit.end());
+
+      //--NB: the last edge of a cut circuit is a filler; no empty trail
+      trail_t trail{{circuit.front()->from}, is_closed};
+      for  (auto const *const edge: circuit)
+      {
+        if  (edge->is_filler)
+        {
+          trails.push_back(trail);
+          trail = trail_t{{edge->to}, false};
+        }
+        else
+          trail.vertices.push_back(edge->to);
+      }
+      if  (trail.vertices.size() > 1)
+        trails.push_back(trail);
+    }
+
+    //--chain the trails; NB: prefer one that starts, or passes, where we are
+    ::std::vector<::std::size_t> walk{};
+    ::std::size_t at{prior};
+    while  (not trails.empty())
+    {
+      auto pick{trails.begin()};
+      for  (auto it{trails.begin()}; it != trails.end(); ++it)
+      {
+        if  (it->vertices.front() == at)
+        {
+          pick = it;
+          break;
+        }
+        if  (it->is_closed)
+        {
+          auto const found{::std::ranges::find(it->vertices, at)};
+          if  (found != it->vertices.end())
+          { // rotate the circuit to start here
+            ::std::vector<::std::size_t> rotated{found, it->vertices.end()};
+            rotated.insert(rotated.end(), (it->vertices.begin() + 1), (found + 1));
+            it->vertices = rotated;
+            pick = it;
+            break;
+          }
+        }
+      }
+
+      auto const &vertices{pick->vertices};
+      if  (vertices.front() != at)
+        walk.push_back(vertices.front());  // NB: one cycle to get there
+      walk.insert(walk.end(), (vertices.begin() + 1), vertices.end());
+      at = walk.back();
+      trails.erase(pick);
+    }
+    return  walk;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace coverage
+  {
+    // <none>
+  } // namespace ::coverage
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__COVERAGE_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,315 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  distribution.h
+//  - discrete distributions for stimulus generation; arbitrary weights,
+//    compiled once, sampled from one random word.
+//
+//  Design Decisions:
+//  - alias_t is Walker's alias method, as built by Vose: N columns, each
+//    a threshold and an alias.  A sample takes the column from the low
+//    bits of the word and compares its top 32 bits with the column's
+//    threshold; below, the column, otherwise its alias.  No loop, no
+//    division, no floating point, and one word per sample.
+//  - N is a power of two, so the column is a mask; unused outcomes weigh
+//    zero.  Outcomes of zero weight are never drawn.
+//  - the weights are compiled to thresholds of 2**32; the probability of
+//    each outcome is exact to within N/2**32.
+//  - the weights are any non-negative reals, not all zero; they need not
+//    sum to one.  Bad weights throw ::std::invalid_argument, as does a bad
+//    probability, see: probability(...).
+//  - transition_t is a Markov chain over N outcomes: one alias table per
+//    prior outcome, re-weighted from a count of observed pairs, (prior,
+//    next).  See: adapt(...).  It chases the pairs least observed.
+//
+//  NOTES:
+//  2026-10-16: created; added distribution::alias_t and
+//              distribution::probability(...).
+//  2026-10-16: added distribution::transition_t.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__DISTRIBUTION_H__)
+# define __DISTRIBUTION_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <algorithm>
+# include <array>
+# include <cmath>
+# include <cstddef>
+# include <cstdint>
+# include <ranges>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+  // <none>
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace distribution
+  { // discrete distributions
+    //--one of N outcomes per random word; arbitrary weights
+    template<::std::size_t N>
+    class alias_t;
+
+    //--one of N outcomes per random word, given the prior outcome; the
+    //--weights adapt to the pairs observed
+    template<::std::size_t N>
+    class transition_t;
+
+    //--a probability, from "N/D" or a real in [0, 1]
+    double probability(::std::string const &text);
+  } // namespace ::distribution
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::distribution::probability(text)
+  //--NB: e.g. "1/256", "0.75", "1".
+
+  double distribution::probability(::std::string const &text)
+  {
+    auto const bad{[&text]()
+    { return  ::std::invalid_argument("not a probability: \"" + text + "\""); }};
+
+    double value{0.0};
+    try
+    {
+      ::std::size_t used{0};
+      if  (auto const slash{text.find('/')}; slash == ::std::string::npos)
+      {
+        value = ::std::stod(text, &used);
+        if  (used != text.size())
+          throw  bad();
+      }
+      else
+      {
+        auto const numerator  {text.substr(0, slash)};
+        auto const denominator{text.substr(slash + 1)};
+        double const n{::std::stod(numerator, &used)};
+        if  (used != numerator.size())
+          throw  bad();
+        double const d{::std::stod(denominator, &used)};
+        if  ((used != denominator.size()) or not (d > 0.0))
+          throw  bad();
+        value = (n / d);
+      }
+    }
+    catch (::std::logic_error const &)
+    { // NB: from ::std::stod(...); invalid_argument and out_of_range
+      throw  bad();
+    }
+
+    if  (not ((value >= 0.0) and (value <= 1.0)))
+      throw  bad();
+    return  value;
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::distribution::alias_t<N>
+  //--NB: default constructed, the outcomes are equally likely.
+
+  template<::std::size_t N>
+  class distribution::alias_t final
+  {
+    public:   // published types
+      static_assert((N >= 1) and ((N bitand (N - 1)) == 0) and (N <= (::std::size_t{1} << 32)),
+                    "An alias table has a power of two outcomes, up to 2**32.");
+
+      //--one weight per outcome
+      using weights_t = ::std::array<double, N>;
+
+    public:   // c'tors and d'tor
+      alias_t()
+        : m_column{}
+      {
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, N))
+          m_column[ix] = column_t{one, ix};
+      }
+
+      explicit alias_t(weights_t const &weights)
+        : m_column{}
+      { compile(weights); }
+
+    public:   // accessors
+      ::std::size_t operator()(::std::uint64_t const word) const
+      { // one outcome; the column from the low bits, the compare from the top
+        ::std::size_t const ix{word bitand (N - 1)};
+        return  ((word >> 32) < m_column[ix].threshold) ? ix : m_column[ix].alias;
+      }
+
+      double probability(::std::size_t const outcome) const
+      { // as compiled; NB: for reports
+        ::std::uint64_t share{0};
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, N))
+        {
+          if  (ix == outcome)
+            share = (share + m_column[ix].threshold);
+          if  (m_column[ix].alias == outcome)
+            share = (share + (one - m_column[ix].threshold));
+        }
+        return  (static_cast<double>(share) / (static_cast<double>(one) * static_cast<double>(N)));
+      }
+
+    private:  // local types
+      struct column_t final
+      {
+        ::std::uint64_t threshold;  // of 2**32; below, this column's outcome
+        ::std::size_t   alias;      // otherwise, this outcome
+      };
+
+    private:  // constants
+      static ::std::uint64_t constexpr one{::std::uint64_t{1} << 32};
+
+    private:  // methods
+      void compile(weights_t const &weights)
+      { // Vose: pair each under-full column with an over-full one
+        double sum{0.0};
+        for  (auto const weight: weights)
+        {
+          if  (not (::std::isfinite(weight) and (weight >= 0.0)))
+            throw  ::std::invalid_argument("A weight is a non-negative real.");
+          sum = (sum + weight);
+        }
+        if  (not (sum > 0.0))
+          throw  ::std::invalid_argument("The weights may not all be zero.");
+
+        ::std::array<double, N>     scaled{};
+        ::std::vector<::std::size_t> small{};
+        ::std::vector<::std::size_t> large{};
+        for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, N))
+        {
+          scaled[ix] = ((weights[ix] * static_cast<double>(N)) / sum);
+          ((scaled[ix] < 1.0) ? small : large).push_back(ix);
+        }
+
+        while  ((not small.empty()) and (not large.empty()))
+        {
+          auto const under{small.back()};
+          auto const over {large.back()};
+          small.pop_back();
+          large.pop_back();
+
+          m_column[under] = column_t{threshold_of(scaled[under]), over};
+          scaled[over] = ((scaled[over] + scaled[under]) - 1.0);
+          ((scaled[over] < 1.0) ? small : large).push_back(over);
+        }
+
+        //--NB: the remainder are full, but for rounding
+        for  (auto const ix: small)
+          m_column[ix] = column_t{(weights[ix] > 0.0) ? one : 0, ix};
+        for  (auto const ix: large)
+          m_column[ix] = column_t{one, ix};
+      }
+
+      static ::std::uint64_t threshold_of(double const scaled)
+      { // of 2**32, rounded; NB: zero stays zero
+        // NB: clamped; rounding may carry an over-full column below zero
+        double const clamped{::std::clamp(scaled, 0.0, 1.0)};
+        return  static_cast<::std::uint64_t>(::std::llround(clamped * static_cast<double>(one)));
+      }
+
+    private:  // attributes
+      ::std::array<column_t, N> m_column;  // by the word's low bits
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::distribution::transition_t<N>
+  //--NB: default constructed, or adapted to no observations, the outcomes
+  //--    are equally likely.
+  //--NB: adapt(...) weighs the pair (prior, next) as
+  //--      (1 + holes(next)) / (1 + count(prior, next))**2
+  //--    where holes(next) is the number of pairs (next, any) not yet
+  //--    observed.  A pair not yet observed outweighs one that has been,
+  //--    and an outcome with pairs yet to be observed draws the chain to
+  //--    it, that they may be.  Every pair keeps a non-zero weight.
+
+  template<::std::size_t N>
+  class distribution::transition_t final
+  {
+    public:   // published types
+      //--the observed count of each pair, [prior][next]
+      using counts_t = unsigned[N][N];
+
+    public:   // c'tors and d'tor
+      transition_t()
+        : m_row{}
+        , m_prior{0}
+      { /* noOp */ }
+
+    public:   // accessors
+      ::std::size_t prior() const
+      { return  m_prior; }
+
+      void prior(::std::size_t const outcome)
+      { // where the chain is; NB: e.g. as last observed
+        m_prior = (outcome bitand (N - 1));
+      }
+
+    public:   // methods
+      ::std::size_t operator()(::std::uint64_t const word)
+      { // the next outcome, which becomes the prior
+        m_prior = m_row[m_prior](word);
+        return  m_prior;
+      }
+
+      void adapt(counts_t const &counts)
+      { // re-weigh every row from the given counts
+        ::std::array<double, N> holes{};
+        for  (auto const from: ::std::ranges::views::iota(::std::size_t{0}, N))
+          for  (auto const count: counts[from])
+            holes[from] = (holes[from] + ((count == 0) ? 1.0 : 0.0));
+
+        for  (auto const from: ::std::ranges::views::iota(::std::size_t{0}, N))
+        {
+          typename alias_t<N>::weights_t weights{};
+          for  (auto const to: ::std::ranges::views::iota(::std::size_t{0}, N))
+          {
+            double const seen{1.0 + static_cast<double>(counts[from][to])};
+            weights[to] = ((1.0 + holes[to]) / (seen * seen));
+          }
+          m_row[from] = alias_t<N>{weights};
+        }
+      }
+
+    private:  // attributes
+      ::std::array<alias_t<N>, N> m_row;    // by the prior outcome
+      ::std::size_t               m_prior;  // the last outcome drawn
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace distribution
+  {
+    // <none>
+  } // namespace ::distribution
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__DISTRIBUTION_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
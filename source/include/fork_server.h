@@ -0,0 +1,247 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  fork_server.h
+//  - fork server: one elaborated, reset simulation forks a copy-on-write
+//    child per seed; each child runs on from the fork point.
+//
+//  Design Decisions:
+//  - the parent never runs on; it serves the seeds, reports, and exits.
+//    The fork point is chosen by the test, see: test.h.
+//  - at most one child per hardware thread runs at a time.
+//  - a child reports one result_t through a pipe, written raw; it is
+//    trivially copyable and smaller than PIPE_BUF, thus written whole.
+//  - the SystemC kernel is forked from within a thread process; this
+//    needs the single OS thread coroutine packages, e.g. QuickThreads,
+//    and not the pthreads package.
+//
+//  NOTES:
+//  2026-10-16: created.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__FORK_SERVER_H__)
+# define __FORK_SERVER_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+
+# include <algorithm>
+# include <chrono>
+# include <cstdint>
+# include <cstdio>
+# include <cstdlib>
+# include <iostream>
+# include <map>
+# include <thread>
+# include <type_traits>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace fork_server
+  {
+    //--what a child reports to the parent
+    struct result_t;
+
+    //--the one fork server
+    class server_t;
+
+    //--result_t::return_code when the child did not report
+    int constexpr not_reported{-1};
+  } // namespace fork_server
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+
+  struct fork_server::result_t final
+  { // NB: plain data only; see: Design Decisions
+    int      return_code;    // as per ::utility::uvm_return_code_t
+    unsigned values_pass;    // data values score boards, all instances
+    unsigned values_fail;
+    unsigned values_moot;
+    unsigned controls_pass;  // control bits score boards, all instances
+    unsigned controls_fail;
+    unsigned controls_moot;
+  };
+
+  static_assert(::std::is_trivially_copyable_v<::fork_server::result_t>);
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  class fork_server::server_t final
+  {
+    public:   // c'tors and d'tor
+      static server_t &instance()
+      { // the one server
+        static server_t server{};
+        return  server;
+      }
+
+      server_t(server_t const &) = delete;
+      server_t &operator=(server_t const &) = delete;
+
+    public:   // accessors
+      bool is_child() const
+      { return  m_is_child; }
+
+    public:   // methods
+      ::std::uint64_t serve(::std::uint64_t const first_seed,
+                            ::std::uint64_t const seeds)
+      { // fork a child for each seed; returns the child's seed in the child.
+        // NB: never returns in the parent; reports the results and exits.
+        unsigned const jobs{::std::max(1u, ::std::thread::hardware_concurrency())};
+        ::std::vector<result_t>    results(seeds, result_t{not_reported, 0, 0, 0, 0, 0, 0});
+        ::std::map<pid_t, child_t> running{};
+
+        auto const start{::std::chrono::steady_clock::now()};
+        for  (::std::uint64_t ix{0}; ix < seeds; ++ix)
+        {
+          if  (running.size() == jobs)
+            reap(running, results);
+
+          int pipe_fds[2]{-1, -1};
+          if  (::pipe(pipe_fds) != 0)
+            SC::REPORT_FATAL("The fork server cannot create a pipe.", __FILE__, __LINE__);
+
+          //--NB: otherwise, buffered output is written once per child
+          ::std::cout.flush();
+          ::std::fflush(nullptr);
+
+          pid_t const pid{::fork()};
+          if  (pid < 0)
+            SC::REPORT_FATAL("The fork server cannot fork.", __FILE__, __LINE__);
+          if  (pid == 0)
+          { // the child; runs on
+            ::close(pipe_fds[0]);
+            for  (auto const &[other, child]: running)
+              ::close(child.pipe);
+            m_is_child = true;
+            m_pipe     = pipe_fds[1];
+            return  (first_seed + ix);
+          }
+
+          ::close(pipe_fds[1]);
+          running.emplace(pid, child_t{ix, pipe_fds[0]});
+        }
+
+        while  (not running.empty())
+          reap(running, results);
+        auto const stop{::std::chrono::steady_clock::now()};
+
+        //--the parent reports, then exits
+        ::std::chrono::duration<double> const elapsed{stop - start};
+        bool const is_pass{report(first_seed, results, elapsed.count())};
+        ::std::cout.flush();
+        ::std::_Exit(is_pass ? 0 : 2);
+      }
+
+      void report(result_t const &result)
+      { // the child reports its result to the parent, once
+        if  (not m_is_child or (m_pipe < 0))
+          return;
+        if  (::write(m_pipe, &result, sizeof(result)) != static_cast<::ssize_t>(sizeof(result)))
+          SC::REPORT_FATAL("The fork server child cannot report.", __FILE__, __LINE__);
+        ::close(m_pipe);
+        m_pipe = -1;
+      }
+
+    private:  // types
+      struct child_t
+      {
+        ::std::uint64_t ordinal;  // of the seed, in the sweep
+        int             pipe;     // read end
+      };
+
+    private:  // c'tors and d'tor
+      server_t()
+        : m_is_child{false}
+        , m_pipe{-1}
+      { /* noOp */ }
+
+    private:  // methods
+      static void reap(::std::map<pid_t, child_t> &running,
+                       ::std::vector<result_t>    &results)
+      { // wait for a child to exit, then read its result, if any
+        int         status{0};
+        pid_t const pid{::waitpid(-1, &status, 0)};
+        auto const  found{running.find(pid)};
+        if  (found == running.end())
+          SC::REPORT_FATAL("The fork server lost a child.", __FILE__, __LINE__);
+
+        auto const &child{found->second};
+        result_t    result{};
+        if  (::read(child.pipe, &result, sizeof(result)) == static_cast<::ssize_t>(sizeof(result)))
+          results[child.ordinal] = result;
+        ::close(child.pipe);
+        running.erase(found);
+      }
+
+      static bool report(::std::uint64_t const          first_seed,
+                         ::std::vector<result_t> const &results,
+                         double const                   seconds)
+      { // one line per seed, then a summary; returns true when all passed
+        ::std::uint64_t passed{0};
+        for  (::std::uint64_t ix{0}; ix < results.size(); ++ix)
+        {
+          auto const &result{results[ix]};
+          if  (result.return_code == 0)
+            passed = (passed + 1);
+          ::std::cout << "seed: " << (first_seed + ix)
+                      << " return code: " << result.return_code
+                      << " data values pass/fail/moot: "
+                      << result.values_pass << '/'
+                      << result.values_fail << '/'
+                      << result.values_moot
+                      << " control bits pass/fail/moot: "
+                      << result.controls_pass << '/'
+                      << result.controls_fail << '/'
+                      << result.controls_moot
+                      << ::std::endl;
+        }
+
+        ::std::cout << "seeds: " << results.size()
+                    << " passed: " << passed
+                    << " seconds: " << seconds
+                    << " seeds/s: " << (static_cast<double>(results.size()) / seconds)
+                    << ::std::endl;
+        return  (passed == results.size());
+      }
+
+    private:  // attributes
+      bool m_is_child;  // true: forked by serve(...)
+      int  m_pipe;      // child only: write end, to the parent
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__FORK_SERVER_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,309 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  label.h
+//  - interned debug labels; a debug signal carries a 32-bit label ID in
+//    place of a string.
+//
+//  Design Decisions:
+//  - the table is process-wide; the same text always interns to the same
+//    ID, and an ID resolves back to its text for the life of the process.
+//  - text is resolved only when printed (operator<<, reports, the label
+//    dump); signals compare, copy, and trace the ID alone.
+//  - the DUT/MUT decorates its input label with what the cycle did
+//    ("ADVANCE: ", "FLUSH: ", &c.); the decoration occupies the top bits
+//    of the ID, so decorating is bit arithmetic, not concatenation, and
+//    needs no table entry.  A decorated label decorates afresh; decorations
+//    do not nest.
+//  - ID zero is the empty label; a default-constructed label is empty.
+//  - a deferred label is a formatter and its arguments, not text; it
+//    interns as the record, and is formatted the first time its text is
+//    asked for (a report, the label dump), then kept.  A sequence labels
+//    each item with no formatting, and no text is built that no one reads.
+//    NB: a deferred label and a text label of the same text are distinct
+//        IDs.
+//
+//  NOTES:
+//  2026-10-16: created; added label::table_t and label::label_t.
+//  2026-10-16: added deferred labels; see: label::formatter_t.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__LABEL_H__)
+# define __LABEL_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <array>
+# include <cstdint>
+# include <deque>
+# include <functional>
+# include <ostream>
+# include <string>
+# include <string_view>
+# include <unordered_map>
+# include <utility>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace label
+  { // interned debug labels
+    using id_t = ::std::uint32_t;
+
+    //--what a DUT/MUT cycle did to its input; see: label_t::decorated(...)
+    enum class decoration_t : id_t
+    {
+      none,
+      reset,
+      flush,
+      stall,
+      advance,
+      nop,
+    };
+
+    //--the arguments of a deferred label; e.g. a cycle and its bits.
+    using arguments_t = ::std::array<::std::uint64_t, 2>;
+
+    //--formats a deferred label's arguments; a plain function, called
+    //--only when the label's text is asked for.
+    using formatter_t = ::std::string (*)(arguments_t const &);
+
+    //--process-wide interning table.
+    class table_t;
+
+    //--an interned label; the value a debug signal carries.
+    class label_t;
+  } // namespace ::label
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::label::table_t
+  //--NB: entries live in a deque, so the views keying the index stay valid
+  //--    as the table grows.
+  //--NB: a deferred entry's text is empty until first asked for.
+
+  class label::table_t final
+  {
+    public:   // c'tors and d'tor
+      table_t(table_t const &) = delete;
+      table_t &operator=(table_t const &) = delete;
+
+    public:   // accessors
+      static table_t &instance()
+      { // the one table
+        static table_t table{};
+        return  table;
+      }
+
+      ::std::string const &text(id_t const base) const
+      { // the text of the given undecorated ID; formatted, if deferred
+        auto const &entry{m_entries.at(base)};
+        if  (entry.format != nullptr)
+        {
+          entry.text   = entry.format(entry.arguments);
+          entry.format = nullptr;
+        }
+        return  entry.text;
+      }
+
+      ::std::size_t size() const
+      { return  m_entries.size(); }
+
+    public:   // methods
+      id_t intern(::std::string_view const text)
+      { // the ID of the given text; added on first sight.
+        auto const found{m_index.find(text)};
+        if  (found != m_index.end())
+          return  found->second;
+
+        auto const id{add(entry_t{::std::string{text}, nullptr, {}})};
+        m_index.emplace(m_entries.back().text, id);
+        return  id;
+      }
+
+      id_t intern(formatter_t const format, arguments_t const &arguments)
+      { // the ID of the given deferred label; added on first sight.
+        // NB: nothing is formatted; see: text(...)
+        record_t const record{format, arguments};
+        auto const found{m_deferred.find(record)};
+        if  (found != m_deferred.end())
+          return  found->second;
+
+        auto const id{add(entry_t{{}, format, arguments})};
+        m_deferred.emplace(record, id);
+        return  id;
+      }
+
+      void write(::std::ostream &os) const
+      { // one line per label: ID, a space, then the text.
+        // NB: decodes traced IDs; decorations are the top bits.
+        // NB: formats every deferred label not yet formatted.
+        for  (id_t id{0}; id < m_entries.size(); id = (id + 1))
+          os << id << ' ' << text(id) << '\n';
+      }
+
+    public:   // manifest constants
+      static unsigned constexpr decoration_bits{4};
+      static unsigned constexpr base_bits      {32 - decoration_bits};
+      static id_t constexpr     base_mask      {(id_t{1} << base_bits) - 1};
+
+    private:  // c'tors and d'tor
+      table_t()
+        : m_entries{}
+        , m_index{}
+        , m_deferred{}
+      {
+        intern("");  // NB: ID zero, the empty label
+      }
+
+    private:  // local types
+      struct entry_t final
+      {
+        mutable ::std::string      text;       // deferred: empty until asked
+        mutable formatter_t        format;     // deferred: until formatted
+        arguments_t                arguments;  // deferred: the arguments
+      };
+
+      struct record_t final
+      { // a deferred label's key
+        formatter_t format;
+        arguments_t arguments;
+
+        bool operator==(record_t const &) const = default;
+      };
+
+      struct record_hash_t final
+      {
+        ::std::size_t operator()(record_t const &record) const
+        { // NB: a boost-style combine of the three words
+          ::std::size_t seed{::std::hash<formatter_t>{}(record.format)};
+          for  (auto const each: record.arguments)
+            seed = (seed xor (::std::hash<::std::uint64_t>{}(each) + 0x9e3779b97f4a7c15 +
+                              (seed << 6) + (seed >> 2)));
+          return  seed;
+        }
+      };
+
+    private:  // methods
+      id_t add(entry_t &&entry)
+      { // the ID of the given entry, added
+        auto const id{static_cast<id_t>(m_entries.size())};
+        if  (id > base_mask)
+          SC::REPORT_FATAL("The label table is full.", __FILE__, __LINE__);
+        m_entries.emplace_back(::std::move(entry));
+        return  id;
+      }
+
+    private:  // attributes
+      ::std::deque<entry_t>                                 m_entries;
+      ::std::unordered_map<::std::string_view, id_t>        m_index;     // text labels
+      ::std::unordered_map<record_t, id_t, record_hash_t>   m_deferred;  // deferred labels
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::label::label_t
+  //--NB: constructing from text interns it; do so once, not per cycle.
+
+  class label::label_t final
+  {
+    public:   // c'tors and d'tor
+      constexpr label_t()
+        : m_id{0}
+      { /* noOp */ }
+
+      label_t(char const *const text)
+        : m_id{table_t::instance().intern(text)}
+      { /* noOp */ }
+
+      label_t(::std::string const &text)
+        : m_id{table_t::instance().intern(text)}
+      { /* noOp */ }
+
+      label_t(formatter_t const format, arguments_t const &arguments)
+        : m_id{table_t::instance().intern(format, arguments)}
+      { /* noOp */ }
+
+    public:   // accessors
+      id_t const &id() const
+      { return  m_id; }
+
+      id_t constexpr base() const
+      { return  (m_id bitand table_t::base_mask); }
+
+      decoration_t constexpr decoration() const
+      { return  decoration_t{m_id >> table_t::base_bits}; }
+
+      ::std::string text() const
+      { // resolve to text; NB: allocates, for printing only.
+        static ::std::array<char const *, 6> constexpr prefixes
+        {
+          "", "RESET: ", "FLUSH: ", "STALL: ", "ADVANCE: ", "NOP: ",
+        };
+        return  (prefixes.at(static_cast<::std::size_t>(decoration())) +
+                 table_t::instance().text(base()));
+      }
+
+    public:   // methods
+      label_t constexpr decorated(decoration_t const decoration) const
+      { // this label, decorated; replaces any decoration.
+        auto const top{static_cast<id_t>(decoration) << table_t::base_bits};
+        return  label_t{(base() bitor top), 0};
+      }
+
+      bool operator==(label_t const &) const = default;
+
+    private:  // c'tors and d'tor
+      constexpr label_t(id_t const id, int)
+        : m_id{id}
+      { /* noOp */ }
+
+    private:  // attributes
+      id_t m_id;
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace label
+  {
+    //--required of all signal value types by SystemC
+    inline ::std::ostream &operator<<(::std::ostream &os, label_t const &value)
+    { return  (os << value.text()); }
+
+    inline void sc_trace(::sc_core::sc_trace_file *const tf,
+                         label_t const                  &value,
+                         ::std::string const            &name)
+    { // NB: traces the ID; see: table_t::write(...)
+      ::sc_core::sc_trace(tf, value.id(), name);
+    }
+  } // namespace ::label
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__LABEL_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
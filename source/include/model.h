@@ -23,6 +23,12 @@
 //  2023-06-20: Moore and Peimann: first cut.
 //  2023-06-20: NB: all model data types must be synthesizable.
 //  2023-08-10: Peimann: revised types to "generic" pipeline model.
+//  2026-10-16: added model::signal::clock_if_t; any clock source binds.
+//  2026-10-16: added packed control buses; model::control_in_t and
+//              model::control_out_t, and their field accessors.
+//  2026-10-16: added model::debug_string_t; compiled out when
+//              MODEL_NO_DEBUG_STRING is defined.
+//  2026-10-16: model::debug_string_t is an interned label; see: label.h.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
@@ -35,12 +41,15 @@
 # include <array>
 # include <compare>
 # include <cstdint>
+# include <ostream>
+# include <string>
 
   //--required library includes
   // <none>
 
   //--required project includes
 # include "SC.h"
+# include "label.h"
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--declaratons
@@ -207,6 +216,159 @@
 
   } // namespace model
 
+  namespace model
+  { // diagnostic strings
+    struct no_string_t final
+    { // stands in for a debug string; holds, copies, and compares nothing.
+      // NB: accepts, and discards, whatever a debug string is built from.
+      constexpr no_string_t()
+      { /* noOp */ }
+      constexpr no_string_t(char const *const)
+      { /* noOp */ }
+      no_string_t(::std::string const &)
+      { /* noOp */ }
+
+      no_string_t constexpr decorated(::label::decoration_t const) const
+      { return  no_string_t{}; }
+
+      bool operator==(no_string_t const &) const = default;
+    };
+
+    //--the debug string of DUTs/MUTs and their stimuli
+    //--NB: an interned label; a signal of these costs about as much as
+    //--    an integer signal, see: label.h.
+    //--NB: MODEL_NO_DEBUG_STRING removes the debug string channels
+    //--    altogether from release builds.
+# if  defined(MODEL_NO_DEBUG_STRING)
+    using debug_string_t = no_string_t;
+# else
+    using debug_string_t = ::label::label_t;
+# endif
+  } // namespace model
+
+  namespace model::control
+  { // packed control bus helpers
+    using bits_t = ::std::uint8_t;
+
+    bit_t constexpr inline bit(bits_t const bits, unsigned const position)
+    { // the bit at the given position
+      return  (((bits >> position) bitand 1) != 0);
+    }
+
+    bits_t constexpr inline place(bit_t const value, unsigned const position)
+    { // the given bit, moved to the given position
+      return  static_cast<bits_t>(bits_t{value} << position);
+    }
+  } // namespace model::control
+
+  namespace model
+  {
+    struct control_in_t final
+    { // control inputs common to all pipeline stages, packed
+      // NB: one channel, one write, and one update per cycle in place of
+      //     one for each of four signals.
+      using bits_t = ::model::control::bits_t;
+
+      //--bit positions
+      static unsigned constexpr reset_bit     {0};
+      static unsigned constexpr is_advance_bit{1};
+      static unsigned constexpr is_flush_bit  {2};
+      static unsigned constexpr is_valid_bit  {3};
+
+      bits_t bits;
+
+      static control_in_t constexpr pack(reset_t const      reset,
+                                         is_advance_t const is_advance,
+                                         is_flush_t const   is_flush,
+                                         is_valid_t const   is_valid)
+      {
+        return  control_in_t
+        {
+          static_cast<bits_t>(control::place(reset,      reset_bit)      bitor
+                              control::place(is_advance, is_advance_bit) bitor
+                              control::place(is_flush,   is_flush_bit)   bitor
+                              control::place(is_valid,   is_valid_bit))
+        };
+      }
+
+      reset_t constexpr reset() const
+      { return  control::bit(bits, reset_bit); }
+
+      is_advance_t constexpr is_advance() const
+      { return  control::bit(bits, is_advance_bit); }
+
+      is_flush_t constexpr is_flush() const
+      { return  control::bit(bits, is_flush_bit); }
+
+      is_valid_t constexpr is_valid() const
+      { return  control::bit(bits, is_valid_bit); }
+
+      bool operator==(control_in_t const &) const = default;
+    };
+
+    struct control_out_t final
+    { // control outputs common to all pipeline stages, packed
+      // NB: is_advance is combinational, the others are clocked; the
+      //     channel must nonetheless have a single writer.
+      using bits_t = ::model::control::bits_t;
+
+      //--bit positions
+      static unsigned constexpr is_advance_bit{0};
+      static unsigned constexpr is_error_bit  {1};
+      static unsigned constexpr is_stall_bit  {2};
+      static unsigned constexpr is_valid_bit  {3};
+
+      bits_t bits;
+
+      static control_out_t constexpr pack(is_advance_t const is_advance,
+                                          is_error_t const   is_error,
+                                          is_stall_t const   is_stall,
+                                          is_valid_t const   is_valid)
+      {
+        return  control_out_t
+        {
+          static_cast<bits_t>(control::place(is_advance, is_advance_bit) bitor
+                              control::place(is_error,   is_error_bit)   bitor
+                              control::place(is_stall,   is_stall_bit)   bitor
+                              control::place(is_valid,   is_valid_bit))
+        };
+      }
+
+      is_advance_t constexpr is_advance() const
+      { return  control::bit(bits, is_advance_bit); }
+
+      is_error_t constexpr is_error() const
+      { return  control::bit(bits, is_error_bit); }
+
+      is_stall_t constexpr is_stall() const
+      { return  control::bit(bits, is_stall_bit); }
+
+      is_valid_t constexpr is_valid() const
+      { return  control::bit(bits, is_valid_bit); }
+
+      bool operator==(control_out_t const &) const = default;
+    };
+
+    //--required of all signal value types by SystemC
+    inline ::std::ostream &operator<<(::std::ostream      &os,
+                                      control_in_t const &value)
+    { return  (os << unsigned{value.bits}); }
+
+    inline ::std::ostream &operator<<(::std::ostream       &os,
+                                      control_out_t const &value)
+    { return  (os << unsigned{value.bits}); }
+
+    inline void sc_trace(::sc_core::sc_trace_file *const tf,
+                         control_in_t const             &value,
+                         ::std::string const            &name)
+    { ::sc_core::sc_trace(tf, value.bits, name); }
+
+    inline void sc_trace(::sc_core::sc_trace_file *const tf,
+                         control_out_t const            &value,
+                         ::std::string const            &name)
+    { ::sc_core::sc_trace(tf, value.bits, name); }
+  } // namespace model
+
   namespace model::input_output
   { // functional aspects of the input_output module.
     namespace cc
@@ -354,6 +516,7 @@
   namespace model::signal
   { // (SystemC++) signal type definitions
     using clock_t       = ::SC::clock;
+    using clock_if_t    = ::SC::signal_in_if<bool>;   // any clock source
     using reset_t       = ::SC::signal<model::reset_t>;
     using address_t     = ::SC::signal<model::address_t>;
     using instruction_t = ::SC::signal<model::instruction_t>;
@@ -383,6 +546,11 @@
 
     using i_raw_t       = ::SC::signal<i_raw_t>;
     using i_decoded_t   = ::SC::signal<i_decoded_t>;
+
+    using control_in_t  = ::SC::signal<model::control_in_t>;
+    using control_out_t = ::SC::signal<model::control_out_t>;
+
+    using debug_string_t= ::SC::signal<model::debug_string_t>;
   } // namespace model::signal
 
   namespace model::exprt
@@ -417,6 +585,11 @@
 
     using i_raw_t       = ::SC::exprt<model::signal::i_raw_t>;
     using i_decoded_t   = ::SC::exprt<model::signal::i_decoded_t>;
+
+    using control_in_t  = ::SC::exprt<model::signal::control_in_t>;
+    using control_out_t = ::SC::exprt<model::signal::control_out_t>;
+
+    using debug_string_t= ::SC::exprt<model::signal::debug_string_t>;
   } // namespace model::exprt
 
   namespace model::port
@@ -454,6 +627,11 @@
 
       using i_raw_t       = ::SC::in<model::i_raw_t>;
       using i_decoded_t   = ::SC::in<model::i_decoded_t>;
+
+      using control_in_t  = ::SC::in<model::control_in_t>;
+      using control_out_t = ::SC::in<model::control_out_t>;
+
+      using debug_string_t= ::SC::in<model::debug_string_t>;
     } // namespace model::port::in
     namespace out
     { // namespace model::port::out
@@ -487,9 +665,51 @@
 
       using i_raw_t       = ::SC::out<model::i_raw_t>;
       using i_decoded_t   = ::SC::out<model::i_decoded_t>;
+
+      using control_in_t  = ::SC::out<model::control_in_t>;
+      using control_out_t = ::SC::out<model::control_out_t>;
+
+      using debug_string_t= ::SC::out<model::debug_string_t>;
     } // namespace model::port::out
   } // namespace model::port
 
+  namespace model::control
+  { // typed accessors over a packed control channel
+    // NB: a field reads as the signal it replaces, see: read(); drivers
+    //     and monitors are therefore indifferent to the representation.
+    template<typename PACKED_T, bit_t (PACKED_T::*ACCESSOR)() const>
+    class field_t final
+    {
+      public:   // c'tors and d'tor
+        field_t(::SC::signal_in_if<PACKED_T> const &bus)
+          : m_bus{bus}
+        { /* noOp */ }
+
+      public:   // accessors
+        bit_t read() const
+        { return  (m_bus.read().*ACCESSOR)(); }
+
+      private:  // attributes
+        ::SC::signal_in_if<PACKED_T> const &m_bus;
+    };
+
+    namespace in
+    { // fields of model::control_in_t
+      using reset_t      = field_t<control_in_t, &control_in_t::reset>;
+      using is_advance_t = field_t<control_in_t, &control_in_t::is_advance>;
+      using is_flush_t   = field_t<control_in_t, &control_in_t::is_flush>;
+      using is_valid_t   = field_t<control_in_t, &control_in_t::is_valid>;
+    } // namespace model::control::in
+
+    namespace out
+    { // fields of model::control_out_t
+      using is_advance_t = field_t<control_out_t, &control_out_t::is_advance>;
+      using is_error_t   = field_t<control_out_t, &control_out_t::is_error>;
+      using is_stall_t   = field_t<control_out_t, &control_out_t::is_stall>;
+      using is_valid_t   = field_t<control_out_t, &control_out_t::is_valid>;
+    } // namespace model::control::out
+  } // namespace model::control
+
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--definitions
 
@@ -0,0 +1,377 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  prng.h
+//  - pseudo-random number engines for stimulus generation; alternatives
+//    to ::std::mt19937_64.
+//
+//  Design Decisions:
+//  - every engine is a standard uniform random bit generator of 64-bit
+//    words, with default_seed and seed(...) as ::std::mt19937_64 has, so
+//    each drops in wherever the request random engine is named; see:
+//    ::request::base_t::random_engine_t.
+//  - every engine is plain data; it is checkpointed raw, see: checkpoint.h.
+//  - xoshiro256_t is xoshiro256** (Blackman and Vigna); four words of
+//    state, a handful of shifts, rotates, and xors per word, and jumps
+//    of 2**128 and 2**192 words, see: jump() and long_jump().
+//  - block_t runs LANES xoshiro256** engines side by side, each 2**128
+//    words on from the one before, and generates a block of ROUNDS words
+//    per lane at a time into a buffer; draws are then a buffer read.  The
+//    lane loop has no dependencies between lanes, and the multiplies are
+//    shifts and adds, thus the compiler may vectorise it; no intrinsics.
+//    NB: it pays only where the target has vector rotates, e.g.
+//        -march=native with AVX-512; for the baseline ISA it is slower
+//        than one xoshiro256_t, thus the request engine is xoshiro256_t.
+//        See: bench-request-random.cpp, and request.h.
+//  - seeding expands one 64-bit seed with splitmix64, as the xoshiro
+//    authors recommend.
+//  - stream_seed(...) splits one master seed into many by name; the seed
+//    of a stream depends on the master seed and its own name, and on
+//    nothing else.  Any engine seeded from it is thus repeatable alone.
+//
+//  NOTES:
+//  2026-10-16: created; added prng::xoshiro256_t and prng::block_t.
+//  2026-10-16: added prng::stream_seed(...).
+//  2026-10-16: added block_t<LANES, ROUNDS>::jump().
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__PRNG_H__)
+# define __PRNG_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <array>
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+# include <ranges>
+# include <string_view>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+  // <none>
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace prng
+  { // pseudo-random number engines
+    //--xoshiro256**; one engine.
+    class xoshiro256_t;
+
+    //--xoshiro256**; LANES engines, generated a block at a time.
+    template<::std::size_t LANES = 8, ::std::size_t ROUNDS = 64>
+    class block_t;
+
+    //--the seed expander; the next word of a splitmix64 sequence.
+    ::std::uint64_t constexpr splitmix64(::std::uint64_t &state);
+
+    //--the seed of a named stream, split from a master seed.
+    ::std::uint64_t constexpr stream_seed(::std::uint64_t const  master,
+                                          ::std::string_view const name);
+  } // namespace ::prng
+
+  namespace prng::xoshiro256
+  { // the xoshiro256** step, for one engine or many
+    using state_t = ::std::array<::std::uint64_t, 4>;
+
+    //--jump polynomials; 2**128 and 2**192 words
+    state_t constexpr jump_by_2_128
+    {
+      0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+      0xa9582618e03fc9aa, 0x39abdc4529b1661c,
+    };
+    state_t constexpr jump_by_2_192
+    {
+      0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+      0x77710069854ee241, 0x39109bb02acbe635,
+    };
+
+    ::std::uint64_t constexpr rotl(::std::uint64_t const x, int const k)
+    { return  ((x << k) bitor (x >> (64 - k))); }
+
+    ::std::uint64_t constexpr next(::std::uint64_t &s0,
+                                   ::std::uint64_t &s1,
+                                   ::std::uint64_t &s2,
+                                   ::std::uint64_t &s3)
+    { // one word; NB: x*5 and x*9 as shifts and adds, which vectorise
+      ::std::uint64_t const x     {s1 + (s1 << 2)};
+      ::std::uint64_t const r     {rotl(x, 7)};
+      ::std::uint64_t const result{r + (r << 3)};
+      ::std::uint64_t const t     {s1 << 17};
+
+      s2 = (s2 xor s0);
+      s3 = (s3 xor s1);
+      s1 = (s1 xor s2);
+      s0 = (s0 xor s3);
+      s2 = (s2 xor t);
+      s3 = rotl(s3, 45);
+
+      return  result;
+    }
+
+    void constexpr jump(state_t &state, state_t const &polynomial)
+    { // advance the state as far as the polynomial says
+      state_t jumped{};
+      for  (auto const word: polynomial)
+        for  (auto const bit: ::std::ranges::views::iota(0, 64))
+        {
+          if  (((word >> bit) bitand 1) != 0)
+            for  (auto const ix: ::std::ranges::views::iota(::std::size_t{0}, state.size()))
+              jumped[ix] = (jumped[ix] xor state[ix]);
+          next(state[0], state[1], state[2], state[3]);
+        }
+      state = jumped;
+    }
+
+    state_t constexpr seeded(::std::uint64_t seed)
+    { // a state from one seed; see: splitmix64(...)
+      return  state_t
+      {
+        ::prng::splitmix64(seed),
+        ::prng::splitmix64(seed),
+        ::prng::splitmix64(seed),
+        ::prng::splitmix64(seed),
+      };
+    }
+  } // namespace ::prng::xoshiro256
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::prng::splitmix64(state)
+  //--NB: advances the state.
+
+  inline ::std::uint64_t constexpr prng::splitmix64(::std::uint64_t &state)
+  {
+    state = (state + 0x9e3779b97f4a7c15);
+    ::std::uint64_t z{state};
+    z = ((z xor (z >> 30)) * 0xbf58476d1ce4e5b9);
+    z = ((z xor (z >> 27)) * 0x94d049bb133111eb);
+    return  (z xor (z >> 31));
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--function ::prng::stream_seed(master, name)
+  //--NB: FNV-1a of the name, from the master seed rather than the FNV
+  //--    offset basis; then one splitmix64 step, which mixes every bit of
+  //--    the hash into every bit of the seed.
+  //--NB: e.g. the hierarchical name of a component, or of a sequence.
+
+  inline ::std::uint64_t constexpr prng::stream_seed(::std::uint64_t const  master,
+                                                    ::std::string_view const name)
+  {
+    ::std::uint64_t state{master};
+    for  (auto const each: name)
+      state = ((state xor static_cast<unsigned char>(each)) * 0x0000'0100'0000'01b3);
+    return  ::prng::splitmix64(state);
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::prng::xoshiro256_t
+
+  class prng::xoshiro256_t final
+  {
+    public:   // published types
+      using result_type = ::std::uint64_t;
+
+      //--as per ::std::mt19937_64
+      static result_type constexpr default_seed{5489u};
+
+    public:   // c'tors and d'tor
+      xoshiro256_t()
+        : xoshiro256_t{default_seed}
+      { /* noOp */ }
+
+      explicit xoshiro256_t(result_type const value)
+        : m_state{xoshiro256::seeded(value)}
+      { /* noOp */ }
+
+    public:   // accessors
+      static result_type constexpr min()
+      { return  ::std::numeric_limits<result_type>::min(); }
+
+      static result_type constexpr max()
+      { return  ::std::numeric_limits<result_type>::max(); }
+
+    public:   // methods
+      void seed(result_type const value = default_seed)
+      { m_state = xoshiro256::seeded(value); }
+
+      result_type operator()()
+      { return  xoshiro256::next(m_state[0], m_state[1], m_state[2], m_state[3]); }
+
+      void jump()
+      { // as 2**128 draws; 2**64 non-overlapping streams
+        xoshiro256::jump(m_state, xoshiro256::jump_by_2_128);
+      }
+
+      void long_jump()
+      { // as 2**192 draws; 2**64 starting points for jump()
+        xoshiro256::jump(m_state, xoshiro256::jump_by_2_192);
+      }
+
+      bool operator==(xoshiro256_t const &) const = default;
+
+    private:  // attributes
+      xoshiro256::state_t m_state;
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--class ::prng::block_t<LANES, ROUNDS>
+  //--NB: the words are drawn lane by lane, round by round; a different
+  //--    sequence to that of one xoshiro256_t, from the same seed.
+
+  template<::std::size_t LANES, ::std::size_t ROUNDS>
+  class prng::block_t final
+  {
+    public:   // published types
+      using result_type = ::std::uint64_t;
+
+      static_assert((LANES >= 1) and (ROUNDS >= 1),
+                    "A block has one or more lanes and rounds.");
+
+      //--as per ::std::mt19937_64
+      static result_type constexpr default_seed{5489u};
+
+      //--words per block
+      static ::std::size_t constexpr words{LANES * ROUNDS};
+
+    public:   // c'tors and d'tor
+      block_t()
+        : block_t{default_seed}
+      { /* noOp */ }
+
+      explicit block_t(result_type const value)
+        : m_s0{}
+        , m_s1{}
+        , m_s2{}
+        , m_s3{}
+        , m_buffer{}
+        , m_next{words}
+      { seed(value); }
+
+    public:   // accessors
+      static result_type constexpr min()
+      { return  ::std::numeric_limits<result_type>::min(); }
+
+      static result_type constexpr max()
+      { return  ::std::numeric_limits<result_type>::max(); }
+
+    public:   // methods
+      void seed(result_type const value = default_seed)
+      { // lane 0 from the seed, each next lane 2**128 words on.
+        xoshiro256::state_t state{xoshiro256::seeded(value)};
+        for  (auto const lane: ::std::ranges::views::iota(::std::size_t{0}, LANES))
+        {
+          if  (lane != 0)
+            xoshiro256::jump(state, xoshiro256::jump_by_2_128);
+          set_lane(lane, state);
+        }
+        m_next = words;
+      }
+
+      result_type operator()()
+      {
+        if  (m_next == words)
+          generate();
+        return  m_buffer[m_next++];
+      }
+
+      void jump()
+      { // every lane as 2**128 draws; NB: discards the buffered words
+        // NB: lane n lands where lane n+1 started; the lanes stay disjoint
+        //     from each other, not from where the block was.
+        jump_lanes(xoshiro256::jump_by_2_128);
+      }
+
+      void long_jump()
+      { // every lane as 2**192 draws; NB: discards the buffered words
+        jump_lanes(xoshiro256::jump_by_2_192);
+      }
+
+      bool operator==(block_t const &) const = default;
+
+    private:  // methods
+      void generate()
+      { // one block; the inner loop is over independent lanes
+        // NB: the state is worked on in locals, which cannot alias the
+        //     buffer, and written back once.
+        lane_words_t s0{m_s0};
+        lane_words_t s1{m_s1};
+        lane_words_t s2{m_s2};
+        lane_words_t s3{m_s3};
+        for  (auto const round: ::std::ranges::views::iota(::std::size_t{0}, ROUNDS))
+          for  (auto const lane: ::std::ranges::views::iota(::std::size_t{0}, LANES))
+            m_buffer[(round * LANES) + lane] =
+              xoshiro256::next(s0[lane], s1[lane], s2[lane], s3[lane]);
+        m_s0 = s0;
+        m_s1 = s1;
+        m_s2 = s2;
+        m_s3 = s3;
+        m_next = 0;
+      }
+
+      void jump_lanes(xoshiro256::state_t const &polynomial)
+      {
+        for  (auto const lane: ::std::ranges::views::iota(::std::size_t{0}, LANES))
+        {
+          xoshiro256::state_t state{m_s0[lane], m_s1[lane], m_s2[lane], m_s3[lane]};
+          xoshiro256::jump(state, polynomial);
+          set_lane(lane, state);
+        }
+        m_next = words;
+      }
+
+      void set_lane(::std::size_t const lane, xoshiro256::state_t const &state)
+      {
+        m_s0[lane] = state[0];
+        m_s1[lane] = state[1];
+        m_s2[lane] = state[2];
+        m_s3[lane] = state[3];
+      }
+
+    private:  // local types
+      using lane_words_t = ::std::array<::std::uint64_t, LANES>;
+
+    private:  // attributes
+      lane_words_t                         m_s0;      // state, by lane
+      lane_words_t                         m_s1;
+      lane_words_t                         m_s2;
+      lane_words_t                         m_s3;
+      ::std::array<::std::uint64_t, words> m_buffer;  // one block
+      ::std::size_t                        m_next;    // next word to draw
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--deferred declarations
+  //--NB: see comments at top of file
+
+  namespace prng
+  {
+    // <none>
+  } // namespace ::prng
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__PRNG_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
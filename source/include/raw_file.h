@@ -0,0 +1,248 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  raw_file.h
+//  - files of plain data, written raw and read in place; what checkpoint.h
+//    and stimulus.h have in common.
+//
+//  Design Decisions:
+//  - a file is read from a read-only mapping, see: mmap(2); its header is
+//    checked against the reading build's, by magic and by version, and by
+//    whatever sizes the caller adds.  A file that does not match is
+//    refused, not misread.
+//  - a file is written to a temporary, and only publish() renames it into
+//    place.  A temporary that is destroyed unpublished is removed; a run
+//    that dies while writing leaves the prior file, or none.
+//    NB: the d'tor does not report; it may run during unwinding.
+//  - a file is named by what it is, e.g. "stimulus", in every report.
+//
+//  NOTES:
+//  2026-10-16: created; from checkpoint.h and stimulus.h.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__RAW_FILE_H__)
+# define __RAW_FILE_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <string>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "SC.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace raw_file
+  {
+    //--a file, mapped in read-only
+    class mapping_t;
+
+    //--a file being written; removed unless published
+    class temporary_t;
+
+    //--whether the given header has the given magic and version
+    template<class HEADER_T>
+    bool is_identified(HEADER_T const     &header,
+                       char const        (&magic)[8],
+                       ::std::uint32_t const version);
+  } // namespace raw_file
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+
+  class raw_file::mapping_t final
+  {
+    public:   // c'tors and d'tor
+      mapping_t(::std::string const &path,
+                ::std::string const &what,
+                ::std::size_t const  minimum_size)
+        : m_what{what + " " + path}
+        , m_base{nullptr}
+        , m_size{0}
+      { // map in the given file; NB: smaller than minimum_size is refused
+        int const fd{::open(path.c_str(), O_RDONLY)};
+        if  (fd < 0)
+          SC::REPORT_FATAL(("Cannot open " + m_what + ".").c_str(), __FILE__, __LINE__);
+
+        //--NB: the fd is closed before any report; the mapping keeps the file
+        struct ::stat status{};
+        bool const is_stat{::fstat(fd, &status) == 0};
+        if  (is_stat)
+          m_size = static_cast<::std::size_t>(status.st_size);
+        if  (is_stat and (m_size >= minimum_size) and (m_size > 0))
+          m_base = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if  (not is_stat)
+          SC::REPORT_FATAL(("Cannot stat " + m_what + ".").c_str(), __FILE__, __LINE__);
+        if  ((m_base == nullptr) or (m_base == MAP_FAILED))
+        {
+          m_base = nullptr;
+          SC::REPORT_FATAL(("Cannot map " + m_what + ".").c_str(), __FILE__, __LINE__);
+        }
+      }
+
+      ~mapping_t()
+      {
+        if  (m_base != nullptr)
+          ::munmap(m_base, m_size);
+      }
+
+      mapping_t(mapping_t const &) = delete;
+      mapping_t &operator=(mapping_t const &) = delete;
+
+    public:   // accessors
+      void const *base() const
+      { return  m_base; }
+
+      ::std::size_t size() const
+      { return  m_size; }
+
+      void const *at(::std::size_t const offset) const
+      { return  (static_cast<char const *>(m_base) + offset); }
+
+    public:   // methods
+      void advise(int const advice) const
+      { // e.g. MADV_SEQUENTIAL; NB: a hint only, see: madvise(2)
+        ::madvise(m_base, m_size, advice);
+      }
+
+      void require(bool const is_match) const
+      { // refuse a file that does not match this build
+        if  (not is_match)
+          SC::REPORT_FATAL(("Cannot read " + m_what + "; it does not match this build.").c_str(),
+                           __FILE__, __LINE__);
+      }
+
+    private:  // attributes
+      ::std::string  m_what;  // for reports; e.g. "stimulus PATH"
+      void          *m_base;  // the mapping; NB: page aligned
+      ::std::size_t  m_size;  // of the mapping, and of the file
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  class raw_file::temporary_t final
+  {
+    public:   // c'tors and d'tor
+      temporary_t(::std::string const &path,
+                  ::std::string const &what)
+        : m_path{path}
+        , m_temporary{path + ".tmp"}
+        , m_what{what}
+        , m_fd{-1}
+      {
+        m_fd = ::open(m_temporary.c_str(), (O_WRONLY bitor O_CREAT bitor O_TRUNC), 0644);
+        if  (m_fd < 0)
+          SC::REPORT_FATAL(("Cannot create " + m_what + " " + m_temporary + ".").c_str(), __FILE__, __LINE__);
+      }
+
+      ~temporary_t()
+      { // NB: unpublished; discarded, and not reported
+        if  (m_fd < 0)
+          return;
+        ::close(m_fd);
+        ::unlink(m_temporary.c_str());
+      }
+
+      temporary_t(temporary_t const &) = delete;
+      temporary_t &operator=(temporary_t const &) = delete;
+
+    public:   // accessors
+      bool is_open() const
+      { return  (m_fd >= 0); }
+
+    public:   // methods
+      void write(void const *const data, ::std::size_t const size)
+      { // all of it, at the end, or fatal
+        auto const *bytes{static_cast<char const *>(data)};
+        ::std::size_t done{0};
+        while  (done < size)
+        {
+          auto const written{::write(m_fd, (bytes + done), (size - done))};
+          if  (written <= 0)
+            fail();
+          done = (done + static_cast<::std::size_t>(written));
+        }
+      }
+
+      void write_at(void const *const   data,
+                    ::std::size_t const size,
+                    ::off_t const       offset)
+      { // all of it, in place, or fatal; e.g. a header filled in last
+        if  (::pwrite(m_fd, data, size, offset) != static_cast<::ssize_t>(size))
+          fail();
+      }
+
+      void publish()
+      { // sync, and rename into place
+        bool const is_synced{::fsync(m_fd) == 0};
+        ::close(m_fd);
+        m_fd = -1;
+        if  (not is_synced or (::rename(m_temporary.c_str(), m_path.c_str()) != 0))
+        {
+          ::unlink(m_temporary.c_str());
+          SC::REPORT_FATAL(("Cannot write " + m_what + " " + m_path + ".").c_str(), __FILE__, __LINE__);
+        }
+      }
+
+    private:  // methods
+      void fail()
+      { // NB: the temporary is discarded by the d'tor
+        SC::REPORT_FATAL(("Cannot write " + m_what + " " + m_temporary + ".").c_str(), __FILE__, __LINE__);
+      }
+
+    private:  // attributes
+      ::std::string m_path;
+      ::std::string m_temporary;  // renamed to m_path by publish()
+      ::std::string m_what;       // for reports; e.g. "checkpoint"
+      int           m_fd;         // -1: published, or discarded
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  template<class HEADER_T>
+  bool raw_file::is_identified(HEADER_T const     &header,
+                               char const        (&magic)[8],
+                               ::std::uint32_t const version)
+  {
+    static_assert(sizeof(header.magic) == sizeof(magic));
+    return  (::std::memcmp(header.magic, magic, sizeof(magic)) == 0) and
+            (header.version == version);
+  }
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__RAW_FILE_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -0,0 +1,234 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  stimulus.h
+//  - stimulus files: one packed RECORD_T per driven cycle, recorded once
+//    and played back, in place, against any later build.
+//
+//  Design Decisions:
+//  - a file is a header, then the records; each is plain data, written
+//    raw, and read in place from a read-only mapping, see: mmap(2).  As
+//    for checkpoints, see: checkpoint.h; there is no parsing on playback.
+//  - the mapping is advised sequential; the kernel reads ahead, and drops
+//    the pages behind, so a file larger than memory streams through it.
+//  - the header records sizeof(RECORD_T); a file that does not match the
+//    reading build is refused, not misread.
+//  - a writer buffers records, and writes them in large blocks, to a
+//    temporary; close() fills in the header's count, then renames it into
+//    place.  Only close() does; a writer destroyed unclosed, e.g. by a
+//    run that dies while recording, removes its temporary and leaves no
+//    partial file.  See: raw_file.h.
+//  - what a record holds is up to the driver; see: driver.h.
+//
+//  NOTES:
+//  2026-10-16: created.
+//  2026-10-16: the writer's d'tor discards, and does not publish; mapping
+//              and temporaries moved to raw_file.h.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__STIMULUS_H__)
+# define __STIMULUS_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+# include <sys/mman.h>
+
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <string>
+# include <type_traits>
+# include <vector>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+# include "raw_file.h"
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  namespace stimulus
+  {
+    //--the start of every stimulus file
+    struct header_t;
+
+    //--a stimulus file, mapped in for playback
+    template<class RECORD_T>
+    class image_t;
+
+    //--records a stimulus file
+    template<class RECORD_T>
+    class writer_t;
+
+    //--the header's identification
+    char constexpr            magic[8]{'S', 'T', 'I', 'M', 'U', 'L', 'I', '\0'};
+    ::std::uint32_t constexpr version{1};
+
+    //--where the records start; NB: aligned for any RECORD_T up to 16
+    ::std::size_t constexpr   record_offset{32};
+  } // namespace stimulus
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+
+  struct stimulus::header_t final
+  { // NB: plain data only; see: Design Decisions
+    char            magic[8];     // see: ::stimulus::magic
+    ::std::uint32_t version;      // see: ::stimulus::version
+    ::std::uint32_t record_size;  // sizeof(RECORD_T) of the writer
+    ::std::uint64_t records;      // one per driven cycle
+  };
+
+  static_assert(::std::is_trivially_copyable_v<::stimulus::header_t>);
+  static_assert(sizeof(::stimulus::header_t) <= ::stimulus::record_offset);
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  template<class RECORD_T>
+  class stimulus::image_t final
+  {
+    public:   // published types
+      using record_t = RECORD_T;
+
+      static_assert(::std::is_trivially_copyable_v<record_t>);
+      static_assert((::stimulus::record_offset % alignof(record_t)) == 0);
+
+    public:   // c'tors and d'tor
+      image_t(::std::string const &path)
+        : m_file{path, "stimulus", ::stimulus::record_offset}
+      { // map in the given file, and check it matches this build
+        m_file.advise(MADV_SEQUENTIAL);
+
+        auto const &found{header()};
+        m_file.require(::raw_file::is_identified(found, ::stimulus::magic, ::stimulus::version) and
+                       (found.record_size == sizeof(record_t)) and
+                       (m_file.size() == size(found.records)));
+      }
+
+      image_t(image_t const &) = delete;
+      image_t &operator=(image_t const &) = delete;
+
+    public:   // accessors
+      header_t const &header() const
+      { return  *static_cast<header_t const *>(m_file.base()); }
+
+      ::std::size_t records() const
+      { return  static_cast<::std::size_t>(header().records); }
+
+      record_t const *begin() const
+      { // NB: in place; no copy is made
+        return  static_cast<record_t const *>(m_file.at(::stimulus::record_offset));
+      }
+
+      record_t const *end() const
+      { return  (begin() + records()); }
+
+    public:   // methods
+      static ::std::size_t size(::std::uint64_t const records)
+      { // of a file holding the given number of records
+        return  (::stimulus::record_offset + (static_cast<::std::size_t>(records) * sizeof(record_t)));
+      }
+
+    private:  // attributes
+      ::raw_file::mapping_t m_file;
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+  template<class RECORD_T>
+  class stimulus::writer_t final
+  {
+    public:   // published types
+      using record_t = RECORD_T;
+
+      static_assert(::std::is_trivially_copyable_v<record_t>);
+      static_assert((::stimulus::record_offset % alignof(record_t)) == 0);
+
+    public:   // c'tors and d'tor
+      writer_t(::std::string const &path)
+        : m_file{path, "stimulus"}
+        , m_records{0}
+        , m_buffer{}
+      { // create the temporary; the header is filled in by close()
+        char const zeroes[::stimulus::record_offset]{};
+        m_file.write(zeroes, sizeof(zeroes));
+        m_buffer.reserve(buffer_records);
+      }
+
+      ~writer_t()
+      { /* noOp */ }  // NB: unless closed, m_file discards the temporary
+
+      writer_t(writer_t const &) = delete;
+      writer_t &operator=(writer_t const &) = delete;
+
+    public:   // accessors
+      ::std::uint64_t records() const
+      { return  (m_records + m_buffer.size()); }
+
+    public:   // methods
+      void put(record_t const &record)
+      { // one more cycle
+        m_buffer.push_back(record);
+        if  (m_buffer.size() == buffer_records)
+          flush();
+      }
+
+      void close()
+      { // write the remainder and the header; rename into place.
+        // NB: idempotent
+        if  (not m_file.is_open())
+          return;
+
+        flush();
+        header_t header{{}, ::stimulus::version, sizeof(record_t), m_records};
+        ::std::memcpy(header.magic, ::stimulus::magic, sizeof(header.magic));
+        m_file.write_at(&header, sizeof(header), 0);
+        m_file.publish();
+      }
+
+    private:  // constants
+      //--records per write; NB: 32KiB, within -Walloc-size-larger-than
+      static ::std::size_t constexpr buffer_records{(sizeof(record_t) < (32 * 1024))
+                                                    ? ((32 * 1024) / sizeof(record_t)) : 1};
+
+    private:  // methods
+      void flush()
+      {
+        if  (m_buffer.empty())
+          return;
+        m_file.write(m_buffer.data(), (m_buffer.size() * sizeof(record_t)));
+        m_records = (m_records + m_buffer.size());
+        m_buffer.clear();
+      }
+
+    private:  // attributes
+      ::raw_file::temporary_t  m_file;     // published by close()
+      ::std::uint64_t          m_records;  // written; NB: not buffered
+      ::std::vector<record_t>  m_buffer;   // yet to be written
+  };
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__STIMULUS_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
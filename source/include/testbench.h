@@ -0,0 +1,94 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  testbench.h
+//  - C ABI between a testbench built as a shared object and its launcher.
+//
+//  Design Decisions:
+//  - C linkage and plain C types only; the launcher and the testbench
+//    share no C++ runtime state, as each testbench copy is loaded into
+//    its own link-map namespace, see: dlmopen(3).
+//  - one entry point, testbench_run, which elaborates and simulates once,
+//    as sc_main does; a SystemC kernel cannot be restarted, thus a copy
+//    is loaded per run.
+//  - no exception crosses the ABI; see: testbench_result_t::return_code.
+//
+//  NOTES:
+//  2026-10-16: created.
+//  2026-10-16: added testbench::workers_max.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--invocation guard
+#if  not defined(__TESTBENCH_H__)
+# define __TESTBENCH_H__
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--required system includes
+  // <none>
+
+  //--required library includes
+  // <none>
+
+  //--required project includes
+  // <none>
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--declaratons
+
+  extern "C"
+  {
+    //--the outcome of one run
+    struct testbench_result_t
+    {
+      int    return_code;  // as per sc_main; negative: did not complete
+      double seconds;      // wall-clock; elaboration and simulation
+    };
+
+    //--elaborate and simulate once; argv as per sc_main
+    //--NB: returns the return code, which is also stored in the result.
+    int testbench_run(testbench_result_t *result,
+                      int                 argc,
+                      char              **argv);
+
+    //--as looked up by the launcher, see: dlsym(3)
+    using testbench_run_t = decltype(testbench_run);
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  //--definitions
+  //--NB: the name of the entry point, as looked up by the launcher
+  namespace testbench
+  {
+    char const constexpr run_symbol[]{"testbench_run"};
+
+    //--testbench_result_t::return_code when the run did not complete
+    int constexpr load_failed{-1};  // dlmopen(3) or dlsym(3) failed
+    int constexpr exception  {-2};  // an exception escaped the run
+
+    //--the most copies loaded at once
+    //--NB: glibc has 16 link-map namespaces, the launcher's own included
+    unsigned constexpr workers_max{15};
+  } // namespace testbench
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//--end of invocation guard
+#endif // not defined(__TESTBENCH_H__)
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
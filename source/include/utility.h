@@ -23,6 +23,8 @@
 //  2023-10-22: Peimann: added class utility::ring_buffer_t.
 //  2024-08-23: Peimann: added enum uvm_return_code_t.
 //  2024-09-26: Peimann: added namespace utility::format &c.
+//  2026-10-16: added utility::format::indexed(...).
+//  2026-10-16: added class utility::spsc_queue_t.
 //
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
@@ -33,12 +35,14 @@
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
   //--required system includes
 # include <array>
+# include <atomic>
 # include <climits>
 # include <cstddef>
 # include <ostream>
 # include <ranges>
 # include <sstream>
 # include <stdexcept>
+# include <string>
 # include <type_traits>
 
   //--required library includes
@@ -55,6 +59,8 @@
     class activity_indicator_t;
     template<typename element_t, std::size_t N>
     class ring_buffer_t;
+    template<typename element_t, std::size_t N>
+    class spsc_queue_t;
     class test_bits_t;
     enum class uvm_return_code_t;
   } // namespace ::utility
@@ -64,6 +70,7 @@
     enum class options_t;
     template<typename INTEGER_T>
     std::string binary(INTEGER_T const value, unsigned const count);
+    std::string indexed(std::string const &name, std::size_t const index);
   } // namespace ::utility::format
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
@@ -347,6 +354,57 @@
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
+  template<typename element_t, std::size_t N>
+  class utility::spsc_queue_t
+  { // bounded and lock-free; one producer thread, one consumer thread.
+    // NB: N is a power of two; the indices run free, and are masked.
+    // NB: each index is written by one side only, on its own cache line.
+    private:
+      static_assert((N > 0) and ((N bitand (N - 1)) == 0));
+
+    public:
+      using size_type  = std::size_t;
+      using value_type = element_t;
+
+    public:
+      spsc_queue_t(): m_body{}, m_head{0}, m_tail{0}
+      { /* noOp - naught to do  right now */ }
+
+      spsc_queue_t(spsc_queue_t const &that) = delete;
+      spsc_queue_t &operator=(spsc_queue_t const &that) = delete;
+
+      ~spsc_queue_t()
+      { /* noOp */ }
+
+    public:
+      bool try_get(value_type &value)
+      { // consumer only; false when empty
+        auto const head{m_head.load(std::memory_order_relaxed)};
+        if  (head == m_tail.load(std::memory_order_acquire))
+          return  false;
+        value = m_body[head bitand (N - 1)];
+        m_head.store((head + 1), std::memory_order_release);
+        return  true;
+      }
+
+      bool try_put(value_type const &value)
+      { // producer only; false when full
+        auto const tail{m_tail.load(std::memory_order_relaxed)};
+        if  ((tail - m_head.load(std::memory_order_acquire)) == N)
+          return  false;
+        m_body[tail bitand (N - 1)] = value;
+        m_tail.store((tail + 1), std::memory_order_release);
+        return  true;
+      }
+
+    private:
+      std::array<element_t, N>           m_body;  // buffer of elements
+      alignas(64) std::atomic<size_type> m_head;  // next to get; the consumer's
+      alignas(64) std::atomic<size_type> m_tail;  // next to put; the producer's
+  };
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
   class utility::test_bits_t
   {
     public:
@@ -417,6 +475,18 @@
   }
 
   //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+  // ::utility::format::indexed(name, index)
+  // returns the name of the index-th of a replicated thing; used for
+  // instance names and config_db keys.
+  // e.g. indexed("vif", 3) --> "vif_3"
+
+  inline std::string utility::format::indexed(std::string const &name,
+                                              std::size_t const  index)
+  {
+    return  (name + '_' + std::to_string(index));
+  }
+
+  //1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 //  end of reentrance guard
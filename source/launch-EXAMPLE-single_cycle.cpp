@@ -0,0 +1,214 @@
+//
+//  Copyright 2024 Douglas John Moore and Scott Meyer Peimann.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//  launch-EXAMPLE-single_cycle.cpp
+//  - seed sweep of the UVM test, many SystemC kernels in one process.
+//  - each run loads its own copy of the testbench shared object, with its
+//    statically linked SystemC and UVM/SystemC, into a new link-map
+//    namespace; the kernels, the UVM factories, and all other statics are
+//    thereby distinct.  Worker threads run one copy each at a time.
+//
+//  Design Decisions:
+//  - a SystemC kernel cannot be restarted, thus each seed loads, runs, and
+//    unloads a fresh copy; see: testbench.h.
+//  - the unload releases the copy's link-map namespace only if the shared
+//    object has no GNU unique symbols; otherwise glibc marks it NODELETE,
+//    and the sweep fails on its 16th load.  The shared object is built
+//    with -fno-gnu-unique, and checked; see: build-linux/Makefile.
+//  - the testbench is reached through the C ABI of testbench.h only.
+//  - no SystemC here; this is a plain C++ program with main().
+//
+//  USAGE:
+//    launch-EXAMPLE-single_cycle LIBRARY WORKERS FIRST_SEED SEEDS [ARGS...]
+//      LIBRARY: the testbench shared object, e.g.
+//        ./libuvm-EXAMPLE-single_cycle.so
+//      WORKERS: the number of concurrent kernels.
+//        NB: glibc supports 16 link-map namespaces, the launcher's own
+//            included; thus at most 15 workers, loaded at once.  More are
+//            refused, see: ::testbench::workers_max.
+//      FIRST_SEED, SEEDS: runs seeds FIRST_SEED to FIRST_SEED + SEEDS - 1.
+//      ARGS: passed on to every run, e.g. --instances 4.
+//    NB: each run is also given --seed S and --trace-file /tmp/trace_file_S.
+//
+//  OUTPUT:
+//    one line per seed: seed, return code, wall-clock seconds; then one
+//    line: seeds, passed, wall-clock seconds, seeds per second.
+//    NB: the runs' own UVM reports interleave on the standard output.
+//
+//  RETURN CODES:
+//    0: every seed passed.
+//    1: usage error.
+//    2: a seed failed, or did not complete.
+//
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+//--required system includes
+#include <dlfcn.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//--required library includes
+// <none>
+
+//--required project includes
+#include "testbench.h"
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+namespace
+{
+  //--a sweep: what to run, and how
+  struct sweep_t
+  {
+    ::std::string                library;     // testbench shared object
+    unsigned                     workers;     // concurrent kernels
+    ::std::uint64_t              first_seed;  // of the sweep
+    ::std::uint64_t              seeds;       // in the sweep
+    ::std::vector<::std::string> arguments;   // passed on to every run
+  };
+
+  testbench_result_t run(sweep_t const &sweep, ::std::uint64_t const seed)
+  { // one run, in its own link-map namespace
+    testbench_result_t result{::testbench::load_failed, 0.0};
+
+    void *const handle{::dlmopen(LM_ID_NEWLM,
+                                 sweep.library.c_str(),
+                                 (RTLD_NOW bitor RTLD_LOCAL))};
+    if  (handle == nullptr)
+    {
+      ::std::cerr << ::dlerror() << ::std::endl;
+      return  result;
+    }
+
+    auto *const testbench_run_f{reinterpret_cast<testbench_run_t *>(
+                                  ::dlsym(handle, ::testbench::run_symbol))};
+    if  (testbench_run_f == nullptr)
+      ::std::cerr << ::dlerror() << ::std::endl;
+    else
+    { // NB: argv as per main(); strings and pointers outlive the run
+      ::std::vector<::std::string> arguments{"uvm-EXAMPLE-single_cycle"};
+      arguments.insert(arguments.end(),
+                       sweep.arguments.begin(),
+                       sweep.arguments.end());
+      arguments.insert(arguments.end(),
+                       {"--seed",
+                        ::std::to_string(seed),
+                        "--trace-file",
+                        "/tmp/trace_file_" + ::std::to_string(seed)});
+
+      ::std::vector<char *> argv{};
+      for  (auto &argument: arguments)
+        argv.push_back(argument.data());
+      argv.push_back(nullptr);
+
+      testbench_run_f(&result,
+                      static_cast<int>(arguments.size()),
+                      argv.data());
+    }
+
+    //--NB: releases the namespace; see: Design Decisions
+    ::dlclose(handle);
+    return  result;
+  }
+
+  void work(sweep_t const                     &sweep,
+            ::std::atomic<::std::uint64_t>    &next,
+            ::std::vector<testbench_result_t> &results)
+  { // take seeds until there are none left
+    // NB: each seed's result has its own element; no locking.
+    for  (auto ix{next++}; ix < sweep.seeds; ix = next++)
+      results[ix] = run(sweep, (sweep.first_seed + ix));
+  }
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+
+int main(int const    argc,
+         char **const argv)
+{
+  if  (argc < 5)
+  {
+    ::std::cerr << "usage: " << argv[0]
+                << " LIBRARY WORKERS FIRST_SEED SEEDS [ARGS...]" << ::std::endl;
+    return  1;
+  }
+
+  sweep_t const sweep
+  {
+    argv[1],
+    static_cast<unsigned>(::std::stoul(argv[2])),
+    ::std::stoull(argv[3]),
+    ::std::stoull(argv[4]),
+    {(argv + 5), (argv + argc)},
+  };
+  if  ((sweep.workers < 1) or (sweep.workers > ::testbench::workers_max))
+  {
+    ::std::cerr << "WORKERS must be one to " << ::testbench::workers_max
+                << "; see: dlmopen(3)." << ::std::endl;
+    return  1;
+  }
+
+  //--the sweep; each worker runs a kernel at a time
+  ::std::vector<testbench_result_t> results(sweep.seeds,
+                                            {::testbench::load_failed, 0.0});
+  ::std::atomic<::std::uint64_t>    next{0};
+
+  auto const start{::std::chrono::steady_clock::now()};
+  {
+    ::std::vector<::std::jthread> workers{};
+    for  (unsigned wx{0}; wx < sweep.workers; ++wx)
+      workers.emplace_back(work,
+                           ::std::cref(sweep),
+                           ::std::ref(next),
+                           ::std::ref(results));
+  } // NB: the workers join here
+  auto const stop{::std::chrono::steady_clock::now()};
+
+  //--the results
+  ::std::uint64_t passed{0};
+  for  (::std::uint64_t ix{0}; ix < sweep.seeds; ++ix)
+  {
+    auto const &result{results[ix]};
+    if  (result.return_code == 0)
+      passed = (passed + 1);
+    ::std::cout << "seed: " << (sweep.first_seed + ix)
+                << " return code: " << result.return_code
+                << " seconds: " << result.seconds
+                << ::std::endl;
+  }
+
+  ::std::chrono::duration<double> const elapsed{stop - start};
+  ::std::cout << "seeds: " << sweep.seeds
+              << " passed: " << passed
+              << " seconds: " << elapsed.count()
+              << " seeds/s: " << (static_cast<double>(sweep.seeds) / elapsed.count())
+              << ::std::endl;
+
+  //--end of compilation unit with explicit return
+  return  (passed == sweep.seeds) ? 0 : 2;
+}
+
+//..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
+//
+//--end of file
+//
@@ -30,12 +30,141 @@
 //         NB: should not happen, as the return code is set by the
 //             ::test::base_t::report_phase(...) method.
 //
+//  USAGE:
+//    uvm-EXAMPLE-single_cycle [--method-process] [--instances N] [--seed S]
+//                             [--trace-file PATH] [--fork-server N]
+//                             [--checkpoint PATH] [--restore PATH]
+//                             [--weights SPEC] [--adaptive-weights]
+//                             [--sequence N] [--close-coverage]
+//                             [--coroutine-sequences] [--pregenerate]
+//                             [--record PATH] [--playback PATH]
+//      --method-process: the driver and monitor run as method processes,
+//        one activation per clock edge, rather than as threads.
+//        NB: time warp is a thread-process mode feature; see: driver.h.
+//      --instances N: N replicated DUT/MUT, vif, agent, and score board
+//        instances, sharing the one clock; the default is one.
+//        NB: more than one instance on the shared clock turns time warp
+//            off; see: driver.h.
+//        NB: the n-th vif is the config_db key "vif_<n>"; each instance
+//            randomises from its own streams, see: sequencer.h.
+//      --seed S: the master seed; each sequence's random stream is split
+//        from it by the sequence's hierarchical name, which includes its
+//        instance's agent.  The default is the common generator's seed.
+//        NB: a sequence's stimuli do not depend on which sequences run
+//            before or beside it; see: sequencer.h.
+//      --sequence N: after the resets, run the N-th sequence alone, with
+//        the stimuli it has in a full run; N counts from zero.
+//        NB: shards a run across processes, or re-runs a failing sequence.
+//      --coroutine-sequences: run the coroutine port of each sequence that
+//        has one; its items are pulled by the driver, in the test's thread,
+//        rather than passed through the sequencer.  The stimuli are the same.
+//        NB: see: ::sequence::coroutine_t
+//      --pregenerate: as --coroutine-sequences, but each port runs ahead on
+//        a helper thread, which randomises its items and converts them to
+//        stimuli; the driver takes them from a bounded queue.  The stimuli
+//        are the same.
+//        NB: see: ::sequence::producer_t
+//      --record PATH: record the first instance's stimuli to PATH, one
+//        packed record per driven cycle; see: stimulus.h.
+//        NB: not with --fork-server; its children would share the file.
+//        NB: with --restore, from the checkpoint on.
+//      --playback PATH: drive the stimuli recorded at PATH, on every
+//        instance, in place of the resets and the sequences; the file is
+//        mapped, and read in place.  The score boards check as usual.
+//        NB: the file must be from a build with the same record layout.
+//      --trace-file PATH: the output files' path, less their suffixes;
+//        the default is /tmp/trace_file.
+//        NB: concurrent runs need distinct paths; see: launch-*.cpp.
+//      --fork-server N: elaborate and reset once, then fork a child per
+//        seed, S to S + N - 1, where S is as per --seed; the parent reports
+//        each child's return code and score board counts.
+//        NB: nothing is traced; see: fork_server.h, test.h.
+//      --checkpoint PATH: after the resets, and after each sequence, write
+//        a checkpoint to PATH; each replaces the one before.
+//        NB: not with --fork-server; its children would share the file.
+//      --restore PATH: continue from the checkpoint at PATH; the resets,
+//        and the sequences already run, are skipped.  --instances and the
+//        build options must be as when it was written.
+//        NB: the master seeds are restored, thus --seed is moot; with
+//            --fork-server, each child is reseeded as usual, which
+//            branches many runs from the one checkpoint.
+//        NB: simulated time restarts from zero.
+//      --weights SPEC: the weights of the random control inputs, as
+//        "FIELD=P,..."; the fields are reset, is_advance, is_error,
+//        is_flush, and is_valid, and P is "N/D" or a real, the probability
+//        the input is asserted.  "joint=W0:...:W31" weighs each combination
+//        of the five instead.  The default is "reset=1/256,is_advance=3/4,
+//        is_error=1/1024,is_flush=1/64,is_valid=3/4".
+//        NB: see: ::request::EXAMPLE::single_cycle_t::random_weighted_t
+//        NB: with --restore, as when the checkpoint was written.
+//      --adaptive-weights: run coverage_adaptive_t in place of
+//        random_weighted_t, sequence 1; its control inputs chase the pairs
+//        each instance's score board has yet to observe, re-weighted from
+//        its counts every 64 cycles.  Full pair coverage takes some 2K
+//        cycles.  The fixed weights stall near 450 of the 1024 pairs after
+//        100M cycles; the rarest pairs, e.g. reset, error, and flush at
+//        once, twice running, would take 1e16 and more.  See:
+//        bench-coverage-adaptive.cpp.
+//        NB: the stimuli differ from random_weighted_t's; --weights is moot
+//            for it.
+//        NB: all_control_pairs_t, sequence 0, covers every pair in 1025
+//            cycles, and leaves it nothing to chase; it pays only where
+//            sequence 0 is not run, e.g. with --sequence 1.
+//      --close-coverage: after the sequences, each instance whose control
+//        input pair coverage is incomplete runs coverage_holes_t; a directed
+//        walk that takes every pair not yet observed, and no more than it
+//        must.  A few hundred cycles close what random stimuli leave open.
+//        NB: a full run has no holes to close; all_control_pairs_t, sequence
+//            0, covers every pair.  Only a run without it has, e.g. one with
+//            --sequence N, N not 0.
+//        NB: see: coverage.h, and bench-coverage-adaptive.cpp.
+//
+//  OUTPUT FILES:
+//    /tmp/trace_file.vcd: signal trace; debug labels are traced as IDs.
+//      NB: the first instance only.
+//    /tmp/trace_file.labels: the label table, one "ID text" per line.
+//      NB: the top four bits of a traced ID are a decoration, see: label.h.
+//    NB: both paths follow --trace-file, when given.
+//    NB: neither is written by a fork server.
+//
+//  BUILD OPTIONS:
+//    VIF_BACKEND_NATIVE: when defined, the test runs against the native
+//      cycle model; no clock, no signals, and no MUT are elaborated.
+//      see: ::vif::EXAMPLE::single_cycle_native_t
+//    VIF_BACKEND_TLM: when defined, the test runs loosely timed against
+//      a TLM-2.0 target wrapping the cycle model; one blocking transport
+//      per cycle, and the kernel syncs once per quantum, 4096 cycles.
+//      Nothing is traced.
+//      see: ::vif::EXAMPLE::single_cycle_tlm_t
+//    VIF_BACKEND_BANK: when defined, the test runs against one bit-sliced
+//      bank of cycle models; each instance is one lane, and one evaluation
+//      per clock edge clocks them all.  --instances defaults to the bank
+//      width, 64, and may not exceed it.  Nothing is traced.
+//      see: ::vif::EXAMPLE::single_cycle_bank_t
+//    MODEL_CONTROL_PACKED: when defined, the control signals between the
+//      vif and the MUT are carried as one packed channel per direction.
+//      see: ::model::control_in_t, ::model::control_out_t
+//    MODEL_NO_DEBUG_STRING: when defined, the debug string channels, and
+//      their per-cycle heap allocations, are compiled out; a release run.
+//      see: ::model::debug_string_t
+//    REQUEST_RANDOM_XOSHIRO: when defined, requests randomise from blocked
+//      xoshiro256** engines rather than ::std::mt19937_64; the stimuli
+//      differ, as do checkpoints.
+//      see: ::request::base_t::random_engine_t, prng.h
+//
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
 //--required system includes
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <ranges>
 #include <string>
+#include <vector>
 
 //--required library includes
 // <none>
@@ -44,109 +173,367 @@
 #include "SC.h"
 #include "UVM_wrapper.h"
 
+#include "TLM.h"
+#include "clocking.h"
+#include "label.h"
 #include "EXAMPLE/single_cycle.h"
+#include "EXAMPLE/single_cycle_bank.h"
+#include "EXAMPLE/single_cycle_tlm.h"
 #include "UVM/test.h"
+#include "utility.h"
 
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
-namespace sc_core
+namespace
 {
-  inline void sc_trace(
-    sc_trace_file *const tf    [[maybe_unused]],
-    ::std::string const &value [[maybe_unused]],
-    ::std::string const &name  [[maybe_unused]])
+  //--shorthands
+  using vif_t = ::vif::EXAMPLE::single_cycle_t;
+  using vif_ptr = vif_t*;
+
+  //--the value following the given option, if any
+  char const *option(int const            argc,
+                     char **const         argv,
+                     ::std::string const &name)
   {
-    //throw "sc_trace - we no wanna do ::std::string.";
-    ::sc_core::sc_trace(tf, value.c_str(), (name+".string"));
+    auto const last {argv + argc};
+    auto const found{::std::find(argv + 1, last, name)};
+    return  ((found != last) and ((found + 1) != last)) ? *(found + 1)
+                                                        : nullptr;
   }
+
+  //--one replicated instance: the DUT/MUT and the vif bound to it
+  //--NB: module names are indexed, thus unique within the kernel.
+  class instance_t final
+  {
+    public:   // c'tors and d'tor
+#if  defined(VIF_BACKEND_TLM)
+      instance_t(::std::size_t const index, SC::time const &clock_period)
+        : mut{name("EXAMPLE_single_cycle", index), clock_period}
+        , vif{name("VIF", index)}
+      {
+        //--bind to the target socket
+        vif.socket.bind(mut.socket);
+
+        //--restores reach the target through the vif
+        vif.restore_with([this](auto const &state) { mut.restore(state); });
+      }
+#elif  defined(VIF_BACKEND_BANK)
+      //--NB: the vif is a lane of the bank, which clocks all lanes at once
+      instance_t(::std::size_t const                  index,
+                 vif::EXAMPLE::single_cycle_bank_t &bank)
+        : vif{name("VIF", index), bank}
+      { /* noOp */ }
+#elif  defined(VIF_BACKEND_NATIVE)
+      //--NB: the vif steps the model itself, once per clock period
+      instance_t(::std::size_t const index, SC::time const &clock_period)
+        : vif{name("VIF", index), clock_period}
+      { /* noOp */ }
+#else
+      //--NB: vif constructor takes DUT/MUT exports
+      instance_t(::std::size_t const index, model::signal::clock_if_t &clock)
+        : mut{name("EXAMPLE_single_cycle", index)}
+        , vif
+          {
+            name("VIF", index),
+            clock,
+# if  defined(MODEL_CONTROL_PACKED)
+            mut.control_out().bus,
+# else
+            mut.control_out().is_advance,
+            mut.control_out().is_error,
+            mut.control_out().is_stall,
+            mut.control_out().is_valid,
+# endif
+            mut.data_out().value,
+            mut.debug_out().i_binary,
+            mut.debug_out().i_number,
+            mut.debug_out().is_advance,
+# if  not defined(MODEL_NO_DEBUG_STRING)
+            mut.debug_out().string
+# endif
+          }
+      {
+        //--hook up the DUT/MUT inputs from the vif
+        mut.clock(vif.in.clock.clock);
+# if  defined(MODEL_CONTROL_PACKED)
+        mut.control_in(vif.in.ctl.bus);
+# else
+        mut.control_in(vif.in.ctl.reset,
+                       vif.in.ctl.is_advance,
+                       vif.in.ctl.is_flush,
+                       vif.in.ctl.is_valid);
+# endif
+        mut.data_in   (vif.in.data.value);
+# if  defined(MODEL_NO_DEBUG_STRING)
+        mut.debug_in  (vif.in.debug.i_number,
+                       vif.in.debug.i_binary,
+                       vif.in.debug.is_error);
+# else
+        mut.debug_in  (vif.in.debug.i_number,
+                       vif.in.debug.i_binary,
+                       vif.in.debug.is_error,
+                       vif.in.debug.string);
+# endif
+
+        //--restores reach the DUT/MUT through the vif
+        vif.restore_with([this](auto const &state) { mut.restore(state); });
+      }
+#endif
+
+      instance_t(instance_t const &) = delete;
+      instance_t &operator=(instance_t const &) = delete;
+
+    public:   // attributes
+#if  defined(VIF_BACKEND_TLM)
+      EXAMPLE::single_cycle_tlm_t mut;  // module under test (MUT); a target
+#elif  not (defined(VIF_BACKEND_NATIVE) or defined(VIF_BACKEND_BANK))
+      EXAMPLE::single_cycle_t     mut;  // module under test (MUT)
+#endif
+      vif_t                       vif;  // controls and samples the MUT
+
+    private:  // methods
+      static SC::module_name name(::std::string const &base,
+                                  ::std::size_t const  index)
+      { return  ::utility::format::indexed(base, index).c_str(); }
+  };
 }
 
 //..1..../....2..../....3..../....4..../....5..../....6..../....7..../....8..../
 
-int sc_main(int const    argc [[maybe_unused]],
-            char **const argv [[maybe_unused]])
+int sc_main(int const    argc,
+            char **const argv)
 { // cannot odify argc,
   // cannot modify argv,
   // can modify individual members of argv and strings at the bottom
   // see manpage for getopt_long(3)
 
-  //--shorthands
-  using vif_t = ::vif::EXAMPLE::single_cycle_t;
-  using vif_ptr = vif_t*;
-
   //--run conditions
   SC::time const clock_period{1.0, SC::nsec};
-  double const   clock_duty  {0.5};
-  SC::time const clock_start {0.0, SC::nsec};
 
   SC::time const run_time    {(1 * 1000 * 1000), SC::nsec};
 
-  //--top-level signals
-  std::cout << "Create top-level signals." << std::endl;
-  model::signal::clock_t clock{"clock",
-                               clock_period,
-                               clock_duty,
-                               clock_start};
-
-  //--module under test (MUT) instance
-  std::cout << "Create module under test." << std::endl;
-  EXAMPLE::single_cycle_t mut{"EXAMPLE_single_cycle_0"};
-
-  //--collect exports (bound signals)
-  std::cout << "Collect exported signals from module." << std::endl;
-  auto &m0_control{mut.control_out()};
-  auto &m0_data   {mut.data_out()   };
-  auto &m0_debug  {mut.debug_out()  };
-
-  //--build up the interface used to control and sample the DUT/MUT
-  //--NB: vif constructor takes DUG/MUT exports
-  std::cout << "Create VIF, binds clock and exports from MUT." << std::endl;
-  vif_t vif
+  //--replicated instances
+#if  defined(VIF_BACKEND_BANK)
+  unsigned instances
   {
-    "VIF",
-    clock,
-    m0_control.is_advance,
-    m0_control.is_error,
-    m0_control.is_stall,
-    m0_control.is_valid,
-    m0_data.value,
-    m0_debug.i_binary,
-    m0_debug.i_number,
-    m0_debug.is_advance,
-    m0_debug.string
+    static_cast<unsigned>(::EXAMPLE::single_cycle_bank_t::lanes)
   };
+#else
+  unsigned instances{1};
+#endif
+  if  (auto const value{option(argc, argv, "--instances")}; value != nullptr)
+    instances = static_cast<unsigned>(::std::stoul(value));
+  if  (instances < 1)
+  {
+    ::std::cerr << "--instances must be one or more." << ::std::endl;
+    return  (int)::utility::uvm_return_code_t::not_set;
+  }
+
+  //--stimulus weights; compiled once, before any request randomises
+  if  (auto const value{option(argc, argv, "--weights")}; value != nullptr)
+  {
+    using random_weighted_t =
+      ::request::EXAMPLE::single_cycle_t::random_weighted_t;
+    try
+    {
+      random_weighted_t::weights(random_weighted_t::weights_t::parse(value));
+    }
+    catch (::std::invalid_argument const &error)
+    {
+      ::std::cerr << "--weights: " << error.what() << ::std::endl;
+      return  (int)::utility::uvm_return_code_t::not_set;
+    }
+  }
+
+  //--output files
+  ::std::string trace_file{"/tmp/trace_file"};
+  if  (auto const value{option(argc, argv, "--trace-file")}; value != nullptr)
+    trace_file = value;
 
-  //--hook up the DUT/MUT inputs from the vif
-  std::cout << "Bind input signals to ports in the MUT" << std::endl;
-  mut.clock(vif.in.clock.clock);
-  mut.control_in(vif.in.ctl.reset,
-                 vif.in.ctl.is_advance,
-                 vif.in.ctl.is_flush,
-                 vif.in.ctl.is_valid);
-  mut.data_in   (vif.in.data.value);
-  mut.debug_in  (vif.in.debug.i_number,
-                 vif.in.debug.i_binary,
-                 vif.in.debug.is_error,
-                 vif.in.debug.string);
+  //--checkpoints
+  char const *const checkpoint_file{option(argc, argv, "--checkpoint")};
+  char const *const restore_file   {option(argc, argv, "--restore")};
+  if  ((checkpoint_file != nullptr) and
+       (option(argc, argv, "--fork-server") != nullptr))
+  {
+    ::std::cerr << "--checkpoint and --fork-server are exclusive."
+                << ::std::endl;
+    return  (int)::utility::uvm_return_code_t::not_set;
+  }
+
+  //--stimulus files
+  char const *const record_file  {option(argc, argv, "--record")};
+  char const *const playback_file{option(argc, argv, "--playback")};
+  if  ((record_file != nullptr) and
+       (option(argc, argv, "--fork-server") != nullptr))
+  {
+    ::std::cerr << "--record and --fork-server are exclusive." << ::std::endl;
+    return  (int)::utility::uvm_return_code_t::not_set;
+  }
+
+  ::std::vector<::std::unique_ptr<instance_t>> instance{};
+#if  defined(VIF_BACKEND_TLM)
+  //--loosely timed: thousands of cycles per kernel context switch
+  //--NB: 4096 clock periods, whatever the period
+  SC::time const quantum{clock_period * 4096.0};
+  TLM::set_global_quantum(quantum);
+
+  //--TLM-2.0 targets, each bound to its vif
+  std::cout << "Create TLM targets and VIFs, bind VIFs to targets."
+            << std::endl;
+  for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+    instance.emplace_back(new instance_t{ix, clock_period});
+#elif  defined(VIF_BACKEND_BANK)
+  //--one bank of cycle models; each vif is one of its lanes
+  std::cout << "Create the bank and VIFs, attach VIFs to lanes." << std::endl;
+  vif::EXAMPLE::single_cycle_bank_t bank{"bank", clock_period};
+  for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+    instance.emplace_back(new instance_t{ix, bank});
+#elif  defined(VIF_BACKEND_NATIVE)
+  //--build up the interfaces used to control and sample the cycle models
+  std::cout << "Create VIFs, step the native cycle models." << std::endl;
+  for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+    instance.emplace_back(new instance_t{ix, clock_period});
+#else
+  //--top-level signals
+  //--NB: active edge only; see: clocking.h
+  std::cout << "Create top-level signals." << std::endl;
+  clocking::cycle_clock_t clock{"clock", clock_period};
+
+  //--modules under test (MUT), each bound to its vif
+  std::cout << "Create modules under test and VIFs, bind MUTs to VIFs."
+            << std::endl;
+  for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+    instance.emplace_back(new instance_t{ix, clock});
+#endif
 
   //---insert necessary information into the configuration database
   // agents are active
   uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*", "is_active", true);
-  // VIF address
-  uvm::uvm_config_db<vif_ptr>::set(uvm::uvm_root::get(), "*", "vif", &vif);
+  // drivers may warp time over stable, repeated stimuli
+  // NB: not on a shared clock; one driver's warp would elide the edges of
+  //     every instance, whose monitors would repeat their transactions.
+  //     The native backend clocks each instance alone.
+#if  defined(VIF_BACKEND_NATIVE)
+  bool const is_time_warp{true};
+#else
+  bool const is_time_warp{instances == 1};
+#endif
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_time_warp", is_time_warp);
+  // drivers and monitors run as method, rather than thread, processes
+  bool const is_method_process
+  {
+    ::std::any_of(argv + 1, argv + argc,
+                  [](char const *const arg)
+                  { return  (::std::string{arg} == "--method-process"); })
+  };
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_method_process", is_method_process);
+  // replicated instances, and their VIF addresses
+  uvm::uvm_config_db<unsigned>::set(uvm::uvm_root::get(), "*",
+                                    "instances", instances);
+  for  (auto const ix: ::std::ranges::views::iota(0u, instances))
+    uvm::uvm_config_db<vif_ptr>::set(uvm::uvm_root::get(), "*",
+                                     ::utility::format::indexed("vif", ix),
+                                     &(instance[ix]->vif));
+  // the master seed; NB: otherwise, the sequencers' default
+  if  (auto const value{option(argc, argv, "--seed")}; value != nullptr)
+    uvm::uvm_config_db<::std::uint64_t>::set(uvm::uvm_root::get(), "*",
+                                             "random_seed",
+                                             ::std::stoull(value));
+  // one sequence alone; NB: see: ::test::EXAMPLE::single_cycle_t
+  if  (auto const value{option(argc, argv, "--sequence")}; value != nullptr)
+    uvm::uvm_config_db<::std::uint64_t>::set(uvm::uvm_root::get(), "*",
+                                             "sequence", ::std::stoull(value));
+  // coroutine sequences; NB: see: ::test::EXAMPLE::single_cycle_t
+  bool const is_coroutine
+  {
+    ::std::any_of(argv + 1, argv + argc,
+                  [](char const *const arg)
+                  { return  (::std::string{arg} == "--coroutine-sequences"); })
+  };
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_coroutine", is_coroutine);
+  bool const is_ahead
+  {
+    ::std::any_of(argv + 1, argv + argc,
+                  [](char const *const arg)
+                  { return  (::std::string{arg} == "--pregenerate"); })
+  };
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_ahead", is_ahead);
+  // coverage adaptive weights; NB: see: ::test::EXAMPLE::single_cycle_t
+  bool const is_adaptive
+  {
+    ::std::any_of(argv + 1, argv + argc,
+                  [](char const *const arg)
+                  { return  (::std::string{arg} == "--adaptive-weights"); })
+  };
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_adaptive", is_adaptive);
+  // coverage closure; NB: see: ::test::EXAMPLE::single_cycle_t
+  bool const is_closing
+  {
+    ::std::any_of(argv + 1, argv + argc,
+                  [](char const *const arg)
+                  { return  (::std::string{arg} == "--close-coverage"); })
+  };
+  uvm::uvm_config_db<bool>::set(uvm::uvm_root::get(), "*",
+                                "is_closing", is_closing);
+  // fork server; NB: the first seed is as per --seed
+  ::std::uint64_t fork_seeds{0};
+  if  (auto const value{option(argc, argv, "--fork-server")}; value != nullptr)
+  {
+    fork_seeds = ::std::stoull(value);
+    ::std::uint64_t first_seed
+    {
+      ::request::base_t::random_engine_t::default_seed
+    };
+    if  (auto const seed{option(argc, argv, "--seed")}; seed != nullptr)
+      first_seed = ::std::stoull(seed);
+    uvm::uvm_config_db<::std::uint64_t>::set(uvm::uvm_root::get(), "*",
+                                             "fork_seeds", fork_seeds);
+    uvm::uvm_config_db<::std::uint64_t>::set(uvm::uvm_root::get(), "*",
+                                             "fork_first_seed", first_seed);
+  }
+  // checkpoints; NB: see: ::test::EXAMPLE::single_cycle_t
+  if  (checkpoint_file != nullptr)
+    uvm::uvm_config_db<::std::string>::set(uvm::uvm_root::get(), "*",
+                                           "checkpoint_file", checkpoint_file);
+  if  (restore_file != nullptr)
+    uvm::uvm_config_db<::std::string>::set(uvm::uvm_root::get(), "*",
+                                           "restore_file", restore_file);
+  // stimulus files; NB: see: ::test::EXAMPLE::single_cycle_t
+  if  (record_file != nullptr)
+    uvm::uvm_config_db<::std::string>::set(uvm::uvm_root::get(), "*",
+                                           "record_file", record_file);
+  if  (playback_file != nullptr)
+    uvm::uvm_config_db<::std::string>::set(uvm::uvm_root::get(), "*",
+                                           "playback_file", playback_file);
 
   //--tracing
-  ::std::shared_ptr<SC::trace_file> tf
+  //--NB: the first instance only; the traced names are not indexed
+  //--NB: not when a fork server; its children would share the one file
+  ::std::shared_ptr<SC::trace_file> tf{};
+  if  (fork_seeds == 0)
   {
-    ::sc_core::sc_create_vcd_trace_file("/tmp/trace_file"),
-    [](auto victim) {::sc_core::sc_close_vcd_trace_file(victim);}
-  };
-  vif.trace_to_file(tf.get());
+    tf.reset(::sc_core::sc_create_vcd_trace_file(trace_file.c_str()),
+             [](auto victim) {::sc_core::sc_close_vcd_trace_file(victim);});
+    instance.front()->vif.trace_to_file(tf.get());
+  }
 
   //--setup and run the test
   uvm::uvm_coreservice_t::get()->get_root()->set_timeout(run_time);
   uvm::run_test("::test::EXAMPLE::single_cycle_t");
 
+  //--the label table; decodes the debug label IDs in the trace
+  if  (fork_seeds == 0)
+  {
+    ::std::ofstream labels{trace_file + ".labels"};
+    ::label::table_t::instance().write(labels);
+  }
+
   //--result code
   int return_code{(int)::utility::uvm_return_code_t::not_set};
   ::uvm::uvm_config_db<int>::get(nullptr, "", "return_code", return_code);